@@ -8,11 +8,13 @@
  * embedded systems.  OSC99 implements the OSC 1.0 specification including all
  * optional argument types.  The library also includes a SLIP module for
  * encoding and decoding OSC packets via unframed protocols such as UART/serial
- * as required by the OSC the 1.1 specification.
+ * as required by the OSC the 1.1 specification.  A COBS module is also
+ * included as an alternative framing with a bounded overhead.
  *
  * The following definitions may be modified in OscCommon.h as required by the
  * user application: LITTLE_ENDIAN_PLATFORM, MAX_TRANSPORT_SIZE,
- * OSC_ERROR_MESSAGES_ENABLED.
+ * OSC_ERROR_MESSAGES_ENABLED, OSC_MEMORY_BARRIER, OSC_PREFETCH,
+ * OSC_ATOMIC_COMPARE_AND_SWAP.
  *
  * @see http://opensoundcontrol.org/spec-1_0
  */
@@ -28,9 +30,21 @@ extern "C" {
 #endif
 
 #include "OscAddress.h"
+#include "OscCobs.h"
 #include "OscError.h"
+#include "OscHash.h"
+#include "OscJson.h"
+#include "OscLog.h"
+#include "OscPacer.h"
 #include "OscPacket.h"
+#include "OscPacketPool.h"
 #include "OscSlip.h"
+#include "OscSnapshot.h"
+#include "OscState.h"
+#include "OscStream.h"
+#include "OscSubscriptions.h"
+#include "OscTemplate.h"
+#include "OscText.h"
 
 #ifdef __cplusplus
 }
@@ -10,6 +10,7 @@
 // Includes
 
 #include "OscAddress.h"
+#include "OscMessage.h" // MAX_OSC_ADDRESS_PATTERN_LENGTH
 #include <string.h>
 
 #ifdef _WIN32
@@ -25,6 +26,8 @@ static bool MatchStar(const char * * const oscAddressPattern, const char * * con
 static bool MatchCharacter(const char * * const oscAddressPattern, const char * * const oscAddress, const bool isPartial);
 static bool MatchBrackets(const char * * const oscAddressPattern, const char * * const oscAddress);
 static bool MatchCurlyBraces(const char * * const oscAddressPattern, const char * * const oscAddress, const bool isPartial);
+static bool MatchPathTraversal(const char * oscAddressPattern, const char * oscAddress, const bool isPartial);
+static bool IsPathTraversal(const char * const oscAddressPattern);
 
 //------------------------------------------------------------------------------
 // Functions
@@ -34,7 +37,8 @@ static bool MatchCurlyBraces(const char * * const oscAddressPattern, const char
  *
  * Returns true if the OSC address pattern matches the target OSC address.  The
  * target OSC address cannot contain any special characters: '?', ' *', '[]', or
- * '{}'.
+ * '{}'.  The OSC address pattern may contain the OSC 1.1 path-traversal
+ * wildcard '//' described by MatchPathTraversal.
  *
  * Example use:
  * @code
@@ -95,7 +99,8 @@ bool OscAddressMatchPartial(const char * oscAddressPattern, const char * const o
  *
  * The OSC address pattern is initially assumed to be literal and not to contain
  * any special characters: '?', ' *', '[]', or '{}'.  If a special character is
- * found then the result of MatchExpression is returned.  Matching literal OSC
+ * found then the result of MatchExpression is returned.  If a path-traversal
+ * wildcard '//' is found then the result of MatchPathTraversal is returned.  Matching literal OSC
  * address patterns is faster than matching OSC address patterns that contain
  * special characters.
  *
@@ -108,6 +113,9 @@ bool OscAddressMatchPartial(const char * oscAddressPattern, const char * const o
  */
 static bool MatchLiteral(const char * oscAddressPattern, const char * oscAddress, const bool isPartial) {
     while (*oscAddressPattern != '\0') {
+        if (IsPathTraversal(oscAddressPattern) == true) {
+            return MatchPathTraversal(oscAddressPattern, oscAddress, isPartial);
+        }
         if (*oscAddress == '\0') {
             if (isPartial == true) {
                 return true;
@@ -157,6 +165,9 @@ static bool MatchExpression(const char * * const oscAddressPattern, const char *
                 return true;
             }
         }
+        if (IsPathTraversal(*oscAddressPattern) == true) {
+            return MatchPathTraversal(*oscAddressPattern, *oscAddress, isPartial);
+        }
         if (**oscAddressPattern == '*') {
             if (MatchStar(oscAddressPattern, oscAddress, isPartial) == false) {
                 return false; // fail: unable to match star sequence
@@ -430,11 +441,134 @@ static bool MatchCurlyBraces(const char * * const oscAddressPattern, const char
     return match;
 }
 
+/**
+ * @brief Matches an OSC address pattern starting with a path-traversal
+ * wildcard '//' with the remainder of the target OSC address.
+ *
+ * The OSC address pattern must start with "//".  A path-traversal wildcard
+ * matches any sequence of zero or more OSC address parts.  For example, the
+ * OSC address pattern "//fader" would match the OSC addresses "/fader",
+ * "/mixer/fader" and "/mixer/channel/1/fader".
+ *
+ * The OSC address pattern is split into segments separated by each '//'.  The
+ * special characters within a segment cannot match a '/' character so each
+ * segment matches a fixed number of OSC address parts.  Each segment is
+ * therefore matched to the earliest possible position in the OSC address
+ * without backtracking and the last segment can only match the last OSC
+ * address parts.  The cost is bounded by the number of OSC address parts
+ * multiplied by the length of the OSC address pattern, regardless of the number
+ * of path-traversal wildcards.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscAddressPattern First character of OSC address pattern.
+ * @param oscAddress First character of target OSC address.
+ * @param isPartial Flag indicating if a partial match is acceptable.
+ * @return True if OSC address pattern and target OSC address match.
+ */
+static bool MatchPathTraversal(const char * oscAddressPattern, const char * oscAddress, const bool isPartial) {
+    char segment[MAX_OSC_ADDRESS_PATTERN_LENGTH + 1];
+    char window[MAX_OSC_ADDRESS_PATTERN_LENGTH + 1];
+    do {
+        if (isPartial == true) {
+            return true; // any partial target OSC address may be followed by the parts required by the remainder of the OSC address pattern
+        }
+        if (*oscAddress != '/') {
+            return false; // fail: path-traversal wildcard must start at the start of an OSC address part
+        }
+        oscAddressPattern++; // increment past first '/' of '//'
+
+        // Determine segment length and number of parts
+        const char * endOfSegment = oscAddressPattern + 1;
+        unsigned int numberOfSegmentParts = 1;
+        while ((*endOfSegment != '\0') && (IsPathTraversal(endOfSegment) == false)) {
+            if (*endOfSegment == '/') {
+                numberOfSegmentParts++;
+            }
+            endOfSegment++;
+        }
+
+        // Last segment can only match the last parts of the OSC address
+        if (*endOfSegment == '\0') {
+            unsigned int numberOfPartsToSkip = OscAddressGetNumberOfParts(oscAddress);
+            if (numberOfPartsToSkip < numberOfSegmentParts) {
+                return false; // fail: not enough parts in OSC address
+            }
+            numberOfPartsToSkip -= numberOfSegmentParts;
+            while (numberOfPartsToSkip > 0) {
+                oscAddress++;
+                if (*oscAddress == '/') {
+                    numberOfPartsToSkip--;
+                }
+            }
+            return MatchLiteral(oscAddressPattern, oscAddress, false);
+        }
+
+        // Copy segment as string
+        const size_t segmentLength = endOfSegment - oscAddressPattern;
+        if (segmentLength > MAX_OSC_ADDRESS_PATTERN_LENGTH) {
+            return false; // fail: OSC address pattern too long
+        }
+        memcpy(segment, oscAddressPattern, segmentLength);
+        segment[segmentLength] = '\0';
+
+        // Match segment to earliest window of OSC address parts
+        do {
+            const char * endOfWindow = oscAddress + 1;
+            unsigned int numberOfWindowParts = 1;
+            while (*endOfWindow != '\0') {
+                if (*endOfWindow == '/') {
+                    if (numberOfWindowParts == numberOfSegmentParts) {
+                        break;
+                    }
+                    numberOfWindowParts++;
+                }
+                endOfWindow++;
+            }
+            if (numberOfWindowParts < numberOfSegmentParts) {
+                return false; // fail: not enough parts remaining in OSC address
+            }
+            const size_t windowLength = endOfWindow - oscAddress;
+            if (windowLength > MAX_OSC_ADDRESS_PATTERN_LENGTH) {
+                return false; // fail: OSC address too long
+            }
+            memcpy(window, oscAddress, windowLength);
+            window[windowLength] = '\0';
+            if (MatchLiteral(segment, window, false) == true) {
+                oscAddress = endOfWindow;
+                break;
+            }
+
+            // Advance OSC address to next part
+            do {
+                oscAddress++;
+            } while ((*oscAddress != '/') && (*oscAddress != '\0'));
+            if (*oscAddress == '\0') {
+                return false; // fail: no more parts in OSC address
+            }
+        } while (true);
+        oscAddressPattern = endOfSegment;
+    } while (true);
+}
+
+/**
+ * @brief Returns true if the OSC address pattern starts with a path-traversal
+ * wildcard '//'.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscAddressPattern First character of OSC address pattern.
+ * @return True if the OSC address pattern starts with '//'.
+ */
+static bool IsPathTraversal(const char * const oscAddressPattern) {
+    return (*oscAddressPattern == '/') && (*(oscAddressPattern + 1) == '/');
+}
+
 /**
  * @brief Returns true if the OSC address pattern is literal.
  *
  * A literal OSC address pattern cannot contain any special characters: '?',
- * ' *', '[]', or '{}'.  In some applications it is desirable to reject OSC
+ * ' *', '[]', '{}', or '//'.  In some applications it is desirable to reject OSC
  * address patterns that contain special characters because the use of special
  * characters risks invoking critical methods unintentionally.  For example,
  * critical methods such as "/shutdown" or "/selfdestruct" risk being invoked
@@ -463,6 +597,9 @@ bool OscAddressIsLiteral(const char * oscAddressPattern) {
             default:
                 break;
         }
+        if (IsPathTraversal(oscAddressPattern) == true) {
+            return false;
+        }
         oscAddressPattern++;
     }
     return true;
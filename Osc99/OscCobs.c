@@ -0,0 +1,262 @@
+/**
+ * @file OscCobs.c
+ * @author Seb Madgwick
+ * @brief Functions and structures for encoding and decoding OSC packets using
+ * Consistent Overhead Byte Stuffing (COBS).
+ * @see http://en.wikipedia.org/wiki/Consistent_Overhead_Byte_Stuffing
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCobs.h"
+#include <string.h> // memchr, memcpy, memmove
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Maximum number of data bytes in a block.
+ */
+#define MAX_BLOCK_SIZE (254)
+
+/**
+ * @brief Code of a block of MAX_BLOCK_SIZE bytes that is not followed by a zero
+ * byte.
+ */
+#define MAX_BLOCK_CODE ((unsigned char) 0xFF)
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Encodes an OSC packet as a COBS packet.
+ *
+ * The OSC packet is encoded as a COBS packet, followed by a zero byte
+ * delimiter, and written to the destination address.  The size of the encoded
+ * COBS packet will not exceed OSC_COBS_MAX_ENCODED_SIZE.  If the destination
+ * is too small to contain the encoded COBS packet then the written size will
+ * be 0.
+ *
+ * Example use:
+ * @code
+ * char cobsPacket[OSC_COBS_MAX_ENCODED_SIZE(MAX_OSC_PACKET_SIZE)];
+ * size_t cobsPacketSize;
+ * OscCobsEncodePacket(&oscPacket, &cobsPacketSize, cobsPacket, sizeof(cobsPacket));
+ * @endcode
+ *
+ * @param oscPacket OSC packet to be encoded.
+ * @param cobsPacketSize Size of the encoded COBS packet.
+ * @param destination Destination address of the COBS packet.
+ * @param destinationSize Size of the destination.
+ * @return Error code (0 if successful).
+ */
+OscError OscCobsEncodePacket(const OscPacket * const oscPacket, size_t * const cobsPacketSize, char * const destination, const size_t destinationSize) {
+    *cobsPacketSize = 0; // size will be 0 if function unsuccessful
+    size_t encodedPacketSize = 0;
+    size_t packetIndex = 0;
+    while (true) {
+
+        // Find length of block up to next zero byte
+        size_t blockSize = oscPacket->size - packetIndex;
+        if (blockSize > MAX_BLOCK_SIZE) {
+            blockSize = MAX_BLOCK_SIZE;
+        }
+        const char * const block = &oscPacket->contents[packetIndex];
+        const char * const zero = memchr(block, 0, blockSize);
+        if (zero != NULL) {
+            blockSize = zero - block;
+        }
+
+        // Write block
+        if ((encodedPacketSize + 1 + blockSize) > destinationSize) {
+            return OscErrorDestinationTooSmall; // error: destination too small
+        }
+        destination[encodedPacketSize++] = (char) (blockSize + 1);
+        memcpy(&destination[encodedPacketSize], block, blockSize);
+        encodedPacketSize += blockSize;
+        packetIndex += blockSize;
+
+        // Skip zero byte or end
+        if (zero != NULL) {
+            packetIndex++;
+            continue; // zero byte is always followed by another block
+        }
+        if (packetIndex >= oscPacket->size) {
+            break;
+        }
+    }
+    if (encodedPacketSize >= destinationSize) {
+        return OscErrorDestinationTooSmall; // error: destination too small
+    }
+    destination[encodedPacketSize++] = 0; // delimiter
+    *cobsPacketSize = encodedPacketSize;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Decodes a COBS packet in place.
+ *
+ * This function may be used to decode a COBS packet that has been received
+ * into a buffer, for example, by DMA.  The decoded packet is written to the
+ * start of the same buffer.  The buffer must not contain the zero byte
+ * delimiter.
+ *
+ * Example use:
+ * @code
+ * size_t decodedSize;
+ * if(OscCobsDecode(myBuffer, myBufferSize, &decodedSize) == OscErrorNone) {
+ *     OscPacketInitialiseFromCharArray(&oscPacket, myBuffer, decodedSize);
+ * }
+ * @endcode
+ *
+ * @param buffer Buffer containing the COBS packet.
+ * @param cobsPacketSize Size of the COBS packet, excluding the delimiter.
+ * @param decodedSize Size of the decoded packet.
+ * @return Error code (0 if successful).
+ */
+OscError OscCobsDecode(char * const buffer, const size_t cobsPacketSize, size_t * const decodedSize) {
+    *decodedSize = 0; // size will be 0 if function unsuccessful
+    if (memchr(buffer, 0, cobsPacketSize) != NULL) {
+        return OscErrorUnexpectedZeroInCobsPacket; // error: zero byte within COBS packet
+    }
+    size_t readIndex = 0;
+    size_t writeIndex = 0;
+    while (readIndex < cobsPacketSize) {
+        const unsigned char code = (unsigned char) buffer[readIndex++];
+        const size_t blockSize = code - 1;
+        if ((readIndex + blockSize) > cobsPacketSize) {
+            return OscErrorCobsPacketEndsBeforeEndOfBlock; // error: block incomplete
+        }
+        memmove(&buffer[writeIndex], &buffer[readIndex], blockSize);
+        writeIndex += blockSize;
+        readIndex += blockSize;
+        if ((code != MAX_BLOCK_CODE) && (readIndex < cobsPacketSize)) {
+            buffer[writeIndex++] = 0;
+        }
+    }
+    *decodedSize = writeIndex;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Initialises an OSC COBS decoder structure.
+ *
+ * An OSC COBS decoder structure must be initialised before use.  A
+ * ProcessPacket function must be implemented within the application and
+ * assigned to the OSC COBS decoder structure after initialisation.
+ *
+ * Example use:
+ * @code
+ * void ProcessPacket(OscPacket * const oscPacket){
+ * }
+ *
+ * void Main() {
+ *     OscCobsDecoder oscCobsDecoder;
+ *     OscCobsDecoderInitialise(&oscCobsDecoder);
+ *     oscCobsDecoder.processPacket = ProcessPacket;
+ * }
+ * @endcode
+ *
+ * @param oscCobsDecoder Address OSC COBS decoder structure.
+ */
+void OscCobsDecoderInitialise(OscCobsDecoder * const oscCobsDecoder) {
+    OscPacketInitialise(&oscCobsDecoder->oscPacket);
+    OscCobsDecoderClearBuffer(oscCobsDecoder);
+    oscCobsDecoder->processPacket = NULL;
+    oscCobsDecoder->param = NULL;
+}
+
+/**
+ * @brief Processes byte received within serial stream.
+ *
+ * This function should be called for each consecutive byte received within a
+ * serial stream.  Each byte is decoded as it is received.  If the received
+ * byte is the zero byte delimiter then the decoded OSC packet is provided to
+ * the application via the ProcessPacket function.  Empty COBS packets are
+ * ignored.  A corrupt COBS packet is reported by the error returned for the
+ * byte at which the corruption is detected and all remaining bytes of the COBS
+ * packet are discarded.
+ *
+ * Example use:
+ * @code
+ * while(MySerialDataReady()){
+ *     OscCobsDecoderProcessByte(&oscCobsDecoder, MySerialGetByte());
+ * }
+ * @endcode
+ *
+ * @param oscCobsDecoder Address OSC COBS decoder structure.
+ * @param byte Byte received within serial stream.
+ * @return Error code (0 if successful).
+ */
+OscError OscCobsDecoderProcessByte(OscCobsDecoder * const oscCobsDecoder, const char byte) {
+    OscPacket * const oscPacket = &oscCobsDecoder->oscPacket;
+
+    // Process delimiter
+    if (byte == 0) {
+        const bool isDiscarding = oscCobsDecoder->isDiscarding;
+        const bool isEmpty = (oscPacket->size == 0) && (oscCobsDecoder->isZeroPending == false);
+        const bool isBlockIncomplete = oscCobsDecoder->blockRemaining != 0;
+        if ((isDiscarding == true) || (isEmpty == true)) {
+            OscCobsDecoderClearBuffer(oscCobsDecoder);
+            return OscErrorNone;
+        }
+        if (isBlockIncomplete == true) {
+            OscCobsDecoderClearBuffer(oscCobsDecoder);
+            return OscErrorCobsPacketEndsBeforeEndOfBlock; // error: block incomplete
+        }
+        if (oscCobsDecoder->processPacket == NULL) {
+            OscCobsDecoderClearBuffer(oscCobsDecoder);
+            return OscErrorCallbackFunctionUndefined; // error: user function undefined
+        }
+        oscCobsDecoder->processPacket(oscCobsDecoder->param, oscPacket);
+        OscCobsDecoderClearBuffer(oscCobsDecoder);
+        return OscErrorNone;
+    }
+    if (oscCobsDecoder->isDiscarding == true) {
+        return OscErrorNone;
+    }
+
+    // Process block code
+    if (oscCobsDecoder->blockRemaining == 0) {
+        if (oscCobsDecoder->isZeroPending == true) {
+            if (oscPacket->size >= MAX_OSC_PACKET_SIZE) {
+                oscCobsDecoder->isDiscarding = true;
+                return OscErrorDecodedCobsPacketTooLong; // error: decoded packet too large
+            }
+            oscPacket->contents[oscPacket->size++] = 0;
+        }
+        oscCobsDecoder->blockRemaining = (unsigned char) byte - 1;
+        oscCobsDecoder->isZeroPending = (unsigned char) byte != MAX_BLOCK_CODE;
+        return OscErrorNone;
+    }
+
+    // Process data byte
+    if (oscPacket->size >= MAX_OSC_PACKET_SIZE) {
+        oscCobsDecoder->isDiscarding = true;
+        return OscErrorDecodedCobsPacketTooLong; // error: decoded packet too large
+    }
+    oscPacket->contents[oscPacket->size++] = byte;
+    oscCobsDecoder->blockRemaining--;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Clears the COBS decoder receive buffer.
+ *
+ * Example use:
+ * @code
+ * OscCobsDecoderClearBuffer(&oscCobsDecoder);
+ * @endcode
+ *
+ * @param oscCobsDecoder Address OSC COBS decoder structure.
+ */
+void OscCobsDecoderClearBuffer(OscCobsDecoder * const oscCobsDecoder) {
+    oscCobsDecoder->oscPacket.size = 0;
+    oscCobsDecoder->blockRemaining = 0;
+    oscCobsDecoder->isZeroPending = false;
+    oscCobsDecoder->isDiscarding = false;
+}
+
+//------------------------------------------------------------------------------
+// End of file
@@ -0,0 +1,56 @@
+/**
+ * @file OscCobs.h
+ * @author Seb Madgwick
+ * @brief Functions and structures for encoding and decoding OSC packets using
+ * Consistent Overhead Byte Stuffing (COBS).
+ * @see http://en.wikipedia.org/wiki/Consistent_Overhead_Byte_Stuffing
+ */
+
+#ifndef OSC_COBS_H
+#define OSC_COBS_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscPacket.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Maximum size of an encoded COBS packet, including the delimiter, for
+ * an OSC packet of the specified size.  COBS adds at most one byte for every
+ * 254 bytes.
+ */
+#define OSC_COBS_MAX_ENCODED_SIZE(size) ((size) + ((size) / 254) + 2)
+
+/**
+ * @brief OSC COBS decoder structure.  Structure members are used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    OscPacket oscPacket; // decoded bytes of the current COBS packet
+    unsigned int blockRemaining; // number of bytes remaining in the current block
+    bool isZeroPending; // zero byte follows the current block if it is not the last
+    bool isDiscarding; // current COBS packet is corrupt and will be discarded
+    void ( *processPacket)(void* param, OscPacket * const oscPacket);
+    void* param;
+} OscCobsDecoder;
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+OscError OscCobsEncodePacket(const OscPacket * const oscPacket, size_t * const cobsPacketSize, char * const destination, const size_t destinationSize);
+OscError OscCobsDecode(char * const buffer, const size_t cobsPacketSize, size_t * const decodedSize);
+void OscCobsDecoderInitialise(OscCobsDecoder * const oscCobsDecoder);
+OscError OscCobsDecoderProcessByte(OscCobsDecoder * const oscCobsDecoder, const char byte);
+void OscCobsDecoderClearBuffer(OscCobsDecoder * const oscCobsDecoder);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
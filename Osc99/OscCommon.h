@@ -38,6 +38,45 @@
  */
 #define OSC_ERROR_MESSAGES_ENABLED
 
+/**
+ * @brief Memory barrier used by the OscState and OscLog modules.  This
+ * definition must be provided for compilers that support neither GCC builtins
+ * nor the Windows API if either module is used.
+ */
+#ifndef OSC_MEMORY_BARRIER
+#if defined(__GNUC__)
+#define OSC_MEMORY_BARRIER() __sync_synchronize()
+#elif defined(_MSC_VER)
+#define OSC_MEMORY_BARRIER() MemoryBarrier() // requires windows.h
+#endif
+#endif
+
+/**
+ * @brief Hint to the processor to fetch the memory at the specified address
+ * into the cache.  This definition should be modified if the compiler does not
+ * support GCC builtins.
+ */
+#ifdef __GNUC__
+#define OSC_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define OSC_PREFETCH(address)
+#endif
+
+/**
+ * @brief Atomic compare and swap used by the OscPacketPool module.  Returns
+ * true if the value was equal to oldValue and has been replaced with newValue.
+ * The value must be a 32-bit integer.  This definition must be provided for
+ * compilers that support neither GCC builtins nor the Windows API if the module
+ * is used.
+ */
+#ifndef OSC_ATOMIC_COMPARE_AND_SWAP
+#if defined(__GNUC__)
+#define OSC_ATOMIC_COMPARE_AND_SWAP(value, oldValue, newValue) __sync_bool_compare_and_swap(&(value), oldValue, newValue)
+#elif defined(_MSC_VER)
+#define OSC_ATOMIC_COMPARE_AND_SWAP(value, oldValue, newValue) (InterlockedCompareExchange((volatile LONG *) &(value), (LONG) (newValue), (LONG) (oldValue)) == (LONG) (oldValue)) // requires windows.h
+#endif
+#endif
+
 //------------------------------------------------------------------------------
 // Definitions - 32-bit argument types
 
@@ -76,6 +76,18 @@ char * OscErrorGetMessage(const OscError oscError) {
             return (char *) &"Unexpected argument type.";
         case OscErrorMessageTooShortForArgumentType:
             return (char *) &"OSC message is too short to contain argument type.";
+        case OscErrorInvalidNumericArray:
+            return (char *) &"Blob does not contain a valid numeric array.";
+        case OscErrorUnsupportedNumericArrayType:
+            return (char *) &"Numeric array element type must be int32, float32, int64, or double.";
+        case OscErrorUnknownTypeTag:
+            return (char *) &"OSC type tag string contains an unknown type tag.";
+        case OscErrorArgumentsSizeInconsistentWithTypeTagString:
+            return (char *) &"Arguments size is inconsistent with OSC type tag string.";
+        case OscErrorTooManySignatures:
+            return (char *) &"Maximum number of OSC signatures exceeded.";
+        case OscErrorSignatureNotFound:
+            return (char *) &"OSC type tag string has not been added to OSC signature registry.";
 
             /* OscBundle errors  */
         case OscErrorBundleFull:
@@ -103,11 +115,101 @@ char * OscErrorGetMessage(const OscError oscError) {
 
             /* OscSlip errors  */
         case OscErrorEncodedSlipPacketTooLong:
-            return (char *) &"Encoded SLIP packet size cannot exceed OSC_SLIP_DECODER_BUFFER_SIZE.";
+            return (char *) &"Encoded SLIP packet is too long.";
         case OscErrorUnexpectedByteAfterSlipEsc:
             return (char *) &"Unexpected byte after SLIP ESC byte.";
         case OscErrorDecodedSlipPacketTooLong:
             return (char *) &"Decoded SLIP packet size cannot exceed MAX_OSC_PACKET_SIZE.";
+
+            /* OscCobs errors  */
+        case OscErrorUnexpectedZeroInCobsPacket:
+            return (char *) &"Unexpected zero byte within COBS packet.";
+        case OscErrorCobsPacketEndsBeforeEndOfBlock:
+            return (char *) &"COBS packet ends before end of block.";
+        case OscErrorDecodedCobsPacketTooLong:
+            return (char *) &"Decoded COBS packet size cannot exceed MAX_OSC_PACKET_SIZE.";
+
+            /* OscPacer errors  */
+        case OscErrorPacerQueueFull:
+            return (char *) &"Number of queued OSC packets cannot exceed OSC_PACER_QUEUE_LENGTH.";
+
+            /* OscStream errors  */
+        case OscErrorFramedPacketTooLargeForStream:
+            return (char *) &"Framed OSC packet size cannot exceed OSC_STREAM_BUFFER_SIZE.";
+
+            /* OscSubscriptions errors  */
+        case OscErrorTooManySubscriptions:
+            return (char *) &"Number of subscriptions cannot exceed MAX_OSC_SUBSCRIPTIONS.";
+        case OscErrorTooManySubscriptionNodes:
+            return (char *) &"Number of subscription nodes cannot exceed MAX_OSC_SUBSCRIPTION_NODES.";
+        case OscErrorSubscriptionNotFound:
+            return (char *) &"Subscription not found.";
+
+            /* OscState errors  */
+        case OscErrorTooManyStateSlots:
+            return (char *) &"Number of state slots cannot exceed MAX_OSC_STATE_SLOTS.";
+        case OscErrorStateSlotNotFound:
+            return (char *) &"State slot not found.";
+        case OscErrorStateSlotEmpty:
+            return (char *) &"State slot has not been updated.";
+        case OscErrorMessageTooLargeForStateSlot:
+            return (char *) &"OSC message size cannot exceed OSC_STATE_SLOT_SIZE.";
+        case OscErrorInvalidStateHeader:
+            return (char *) &"Memory does not contain a valid OSC state structure.";
+
+            /* OscTemplate errors  */
+        case OscErrorTooManyTemplates:
+            return (char *) &"Number of OSC templates cannot exceed MAX_OSC_TEMPLATES.";
+        case OscErrorTemplateArgumentsNotFixedSize:
+            return (char *) &"OSC template type tag string cannot contain strings or blobs.";
+
+            /* OscPacketPool errors  */
+        case OscErrorPacketPoolEmpty:
+            return (char *) &"No OSC packets available in OSC packet pool.";
+        case OscErrorPacketNotFromPool:
+            return (char *) &"OSC packet was not acquired from OSC packet pool.";
+        case OscErrorPacketNotAcquired:
+            return (char *) &"OSC packet has already been returned to OSC packet pool.";
+
+            /* OscText errors  */
+        case OscErrorInvalidTextTimeTag:
+            return (char *) &"Text OSC time tag must be written as XXXXXXXX.XXXXXXXX.";
+        case OscErrorInvalidTextAddressPattern:
+            return (char *) &"Text OSC address pattern must start with '/'.";
+        case OscErrorInvalidTextTypeTagString:
+            return (char *) &"Text OSC type tag string must start with ','.";
+        case OscErrorInvalidTextArgument:
+            return (char *) &"Text argument invalid or out of range for type tag.";
+        case OscErrorTooFewTextArguments:
+            return (char *) &"Text contains fewer arguments than type tags.";
+        case OscErrorTooManyTextArguments:
+            return (char *) &"Text contains more arguments than type tags.";
+
+            /* OscJson errors  */
+        case OscErrorInvalidJsonSyntax:
+            return (char *) &"JSON syntax invalid or not supported.";
+        case OscErrorInvalidJsonObject:
+            return (char *) &"JSON object must start with an OSC address pattern or OSC time tag.";
+        case OscErrorInvalidJsonAddressPattern:
+            return (char *) &"JSON OSC address pattern must be a string starting with '/'.";
+        case OscErrorInvalidJsonTypeTagString:
+            return (char *) &"JSON OSC type tag string must be a string starting with ','.";
+        case OscErrorInvalidJsonValue:
+            return (char *) &"JSON value invalid or out of range for type tag.";
+        case OscErrorTooFewJsonValues:
+            return (char *) &"JSON contains fewer values than type tags.";
+        case OscErrorTooManyJsonValues:
+            return (char *) &"JSON contains more values than type tags.";
+        case OscErrorJsonBundleDepthTooLarge:
+            return (char *) &"JSON OSC bundles nested too deeply.";
+        case OscErrorUnbalancedJsonArray:
+            return (char *) &"OSC type tag string array begin and end type tags are unbalanced.";
+
+            /* OscLog errors  */
+        case OscErrorLogFull:
+            return (char *) &"Insufficient space in OSC log.  Record dropped.";
+        case OscErrorLogRecordTooLarge:
+            return (char *) &"OSC log record size must be less than OSC_LOG_BUFFER_SIZE.";
     }
     return (char *) &"Unknown error.";
 #else
@@ -41,6 +41,12 @@ typedef enum {
     OscErrorNoArgumentsAvailable,
     OscErrorUnexpectedArgumentType,
     OscErrorMessageTooShortForArgumentType,
+    OscErrorInvalidNumericArray,
+    OscErrorUnsupportedNumericArrayType,
+    OscErrorUnknownTypeTag,
+    OscErrorArgumentsSizeInconsistentWithTypeTagString,
+    OscErrorTooManySignatures,
+    OscErrorSignatureNotFound,
 
     /* OscBundle errors  */
     OscErrorBundleFull,
@@ -61,6 +67,61 @@ typedef enum {
     OscErrorUnexpectedByteAfterSlipEsc,
     OscErrorDecodedSlipPacketTooLong,
 
+    /* OscCobs errors  */
+    OscErrorUnexpectedZeroInCobsPacket,
+    OscErrorCobsPacketEndsBeforeEndOfBlock,
+    OscErrorDecodedCobsPacketTooLong,
+
+    /* OscPacer errors  */
+    OscErrorPacerQueueFull,
+
+    /* OscStream errors  */
+    OscErrorFramedPacketTooLargeForStream,
+
+    /* OscSubscriptions errors  */
+    OscErrorTooManySubscriptions,
+    OscErrorTooManySubscriptionNodes,
+    OscErrorSubscriptionNotFound,
+
+    /* OscState errors  */
+    OscErrorTooManyStateSlots,
+    OscErrorStateSlotNotFound,
+    OscErrorStateSlotEmpty,
+    OscErrorMessageTooLargeForStateSlot,
+    OscErrorInvalidStateHeader,
+
+    /* OscTemplate errors  */
+    OscErrorTooManyTemplates,
+    OscErrorTemplateArgumentsNotFixedSize,
+
+    /* OscPacketPool errors  */
+    OscErrorPacketPoolEmpty,
+    OscErrorPacketNotFromPool,
+    OscErrorPacketNotAcquired,
+
+    /* OscText errors  */
+    OscErrorInvalidTextTimeTag,
+    OscErrorInvalidTextAddressPattern,
+    OscErrorInvalidTextTypeTagString,
+    OscErrorInvalidTextArgument,
+    OscErrorTooFewTextArguments,
+    OscErrorTooManyTextArguments,
+
+    /* OscJson errors  */
+    OscErrorInvalidJsonSyntax,
+    OscErrorInvalidJsonObject,
+    OscErrorInvalidJsonAddressPattern,
+    OscErrorInvalidJsonTypeTagString,
+    OscErrorInvalidJsonValue,
+    OscErrorTooFewJsonValues,
+    OscErrorTooManyJsonValues,
+    OscErrorJsonBundleDepthTooLarge,
+    OscErrorUnbalancedJsonArray,
+
+    /* OscLog errors  */
+    OscErrorLogFull,
+    OscErrorLogRecordTooLarge,
+
 } OscError;
 
 //------------------------------------------------------------------------------
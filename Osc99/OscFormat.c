@@ -0,0 +1,309 @@
+/**
+ * @file OscFormat.c
+ * @author Seb Madgwick
+ * @brief Functions and structures used internally by the OscText and OscJson
+ * modules to read serialised OSC messages and to write serialised OSC contents
+ * and text to a fixed-size destination.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscFormat.h"
+#include <string.h> // memchr, memcpy
+
+//------------------------------------------------------------------------------
+// Variables
+
+/**
+ * @brief Hexadecimal digits.
+ */
+const char oscFormatHexadecimalDigits[] = "0123456789ABCDEF";
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Initialises an OSC format writer structure.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param oscFormatWriter OSC format writer structure to be initialised.
+ * @param destination Destination.
+ * @param destinationSize Destination size that cannot exceed.
+ */
+void OscFormatWriterInitialise(OscFormatWriter * const oscFormatWriter, char * const destination, const size_t destinationSize) {
+    oscFormatWriter->destination = destination;
+    oscFormatWriter->destinationSize = destinationSize;
+    oscFormatWriter->size = 0;
+    oscFormatWriter->isFull = false;
+}
+
+/**
+ * @brief Writes bytes to the destination.  The writer is marked as full and
+ * nothing is written if the destination is too small.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param oscFormatWriter OSC format writer structure.
+ * @param source Bytes to be written.
+ * @param numberOfBytes Number of bytes to be written.
+ */
+void OscFormatWriterWrite(OscFormatWriter * const oscFormatWriter, const char * const source, const size_t numberOfBytes) {
+    if ((oscFormatWriter->size + numberOfBytes) > oscFormatWriter->destinationSize) {
+        oscFormatWriter->isFull = true;
+        return;
+    }
+    memcpy(&oscFormatWriter->destination[oscFormatWriter->size], source, numberOfBytes);
+    oscFormatWriter->size += numberOfBytes;
+}
+
+/**
+ * @brief Writes null characters until the size written is a multiple of four.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param oscFormatWriter OSC format writer structure.
+ */
+void OscFormatWriterWritePadding(OscFormatWriter * const oscFormatWriter) {
+    static const char padding[3] = {'\0', '\0', '\0'};
+    OscFormatWriterWrite(oscFormatWriter, padding, (4 - (oscFormatWriter->size % 4)) % 4);
+}
+
+/**
+ * @brief Writes a big-endian 32-bit integer.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param destination Destination address of the 4 bytes.
+ * @param int32 Value.
+ */
+void OscFormatWriteInt32(char * const destination, const int32_t int32) {
+    OscArgument32 oscArgument32;
+    oscArgument32.int32 = int32;
+    destination[0] = oscArgument32.byteStruct.byte3;
+    destination[1] = oscArgument32.byteStruct.byte2;
+    destination[2] = oscArgument32.byteStruct.byte1;
+    destination[3] = oscArgument32.byteStruct.byte0;
+}
+
+/**
+ * @brief Reads a big-endian 32-bit argument.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param source Address of the argument.
+ * @return Argument.
+ */
+OscArgument32 OscFormatReadArgument32(const char * const source) {
+    OscArgument32 oscArgument32;
+    oscArgument32.byteStruct.byte3 = source[0];
+    oscArgument32.byteStruct.byte2 = source[1];
+    oscArgument32.byteStruct.byte1 = source[2];
+    oscArgument32.byteStruct.byte0 = source[3];
+    return oscArgument32;
+}
+
+/**
+ * @brief Reads a big-endian 64-bit argument.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param source Address of the argument.
+ * @return Argument.
+ */
+OscArgument64 OscFormatReadArgument64(const char * const source) {
+    OscArgument64 oscArgument64;
+    oscArgument64.byteStruct.byte7 = source[0];
+    oscArgument64.byteStruct.byte6 = source[1];
+    oscArgument64.byteStruct.byte5 = source[2];
+    oscArgument64.byteStruct.byte4 = source[3];
+    oscArgument64.byteStruct.byte3 = source[4];
+    oscArgument64.byteStruct.byte2 = source[5];
+    oscArgument64.byteStruct.byte1 = source[6];
+    oscArgument64.byteStruct.byte0 = source[7];
+    return oscArgument64;
+}
+
+/**
+ * @brief Returns the value of a hexadecimal digit.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param character Character.
+ * @return Value of the hexadecimal digit, or a value greater than 0xF if the
+ * character is not a hexadecimal digit.
+ */
+unsigned int OscFormatGetHexadecimalValue(const char character) {
+    if ((character >= '0') && (character <= '9')) {
+        return character - '0';
+    }
+    if ((character >= 'A') && (character <= 'F')) {
+        return character - 'A' + 0xA;
+    }
+    if ((character >= 'a') && (character <= 'f')) {
+        return character - 'a' + 0xA;
+    }
+    return 0x10;
+}
+
+/**
+ * @brief Initialises an OSC format message structure from a serialised OSC
+ * message.  The OSC address pattern and OSC type tag string are located
+ * without being copied.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param oscFormatMessage OSC format message structure to be initialised.
+ * @param source Serialised OSC message.
+ * @param numberOfBytes Size of the serialised OSC message.
+ * @return Error code (0 if successful).
+ */
+OscError OscFormatMessageInitialise(OscFormatMessage * const oscFormatMessage, const char * const source, const size_t numberOfBytes) {
+
+    // OSC address pattern
+    const char * const addressEnd = memchr(source, '\0', numberOfBytes);
+    if (addressEnd == NULL) {
+        return OscErrorSourceEndsBeforeEndOfAddressPattern; // error: unexpected end of source
+    }
+    const size_t addressLength = addressEnd - source;
+    size_t sourceIndex = (addressLength + 4) & ~(size_t) 3;
+    if ((sourceIndex >= numberOfBytes) || (source[sourceIndex] != ',')) {
+        return OscErrorSourceEndsBeforeStartOfTypeTagString; // error: unexpected end of source
+    }
+
+    // OSC type tag string
+    const char * const typeTagString = &source[sourceIndex];
+    const char * const typeTagStringEnd = memchr(typeTagString, '\0', numberOfBytes - sourceIndex);
+    if (typeTagStringEnd == NULL) {
+        return OscErrorSourceEndsBeforeEndOfTypeTagString; // error: unexpected end of source
+    }
+    const size_t typeTagStringLength = typeTagStringEnd - typeTagString;
+    sourceIndex += (typeTagStringLength + 4) & ~(size_t) 3;
+    if (sourceIndex > numberOfBytes) {
+        return OscErrorUnexpectedEndOfSource; // error: unexpected end of source
+    }
+
+    oscFormatMessage->source = source;
+    oscFormatMessage->numberOfBytes = numberOfBytes;
+    oscFormatMessage->oscAddressPattern = source;
+    oscFormatMessage->oscAddressPatternLength = addressLength;
+    oscFormatMessage->oscTypeTagString = typeTagString;
+    oscFormatMessage->oscTypeTagStringLength = typeTagStringLength;
+    oscFormatMessage->typeTagIndex = 1; // skip comma
+    oscFormatMessage->sourceIndex = sourceIndex;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Returns true if an argument is available indicated by the current
+ * type tag index.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param oscFormatMessage OSC format message structure.
+ * @return True if an argument is available.
+ */
+bool OscFormatMessageIsArgumentAvailable(const OscFormatMessage * const oscFormatMessage) {
+    return oscFormatMessage->typeTagIndex < oscFormatMessage->oscTypeTagStringLength;
+}
+
+/**
+ * @brief Gets the next argument of an OSC format message.  Each type tag,
+ * including those without data, provides an argument.  The type tag index
+ * will only be incremented to the next argument if this function is
+ * successful.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param oscFormatMessage OSC format message structure.
+ * @param oscFormatArgument OSC format argument.
+ * @return Error code (0 if successful).
+ */
+OscError OscFormatMessageGetArgument(OscFormatMessage * const oscFormatMessage, OscFormatArgument * const oscFormatArgument) {
+    if (OscFormatMessageIsArgumentAvailable(oscFormatMessage) == false) {
+        return OscErrorNoArgumentsAvailable; // error: end of type tag string
+    }
+    const OscTypeTag typeTag = (OscTypeTag) oscFormatMessage->oscTypeTagString[oscFormatMessage->typeTagIndex];
+    const size_t sourceIndex = oscFormatMessage->sourceIndex;
+    const size_t bytesAvailable = oscFormatMessage->numberOfBytes - sourceIndex;
+    const char * const argument = &oscFormatMessage->source[sourceIndex];
+    size_t argumentSize; // size including blob size and padding
+    switch (typeTag) {
+        case OscTypeTagInt32:
+        case OscTypeTagFloat32:
+        case OscTypeTagCharacter:
+        case OscTypeTagRgbaColour:
+        case OscTypeTagMidiMessage:
+            argumentSize = sizeof (OscArgument32);
+            oscFormatArgument->data = argument;
+            oscFormatArgument->size = argumentSize;
+            break;
+        case OscTypeTagInt64:
+        case OscTypeTagTimeTag:
+        case OscTypeTagDouble:
+            argumentSize = sizeof (OscArgument64);
+            oscFormatArgument->data = argument;
+            oscFormatArgument->size = argumentSize;
+            break;
+        case OscTypeTagString:
+        case OscTypeTagAlternateString:
+        {
+            const char * const stringEnd = memchr(argument, '\0', bytesAvailable);
+            if (stringEnd == NULL) {
+                return OscErrorMessageTooShortForArgumentType; // error: message too short to contain argument
+            }
+            oscFormatArgument->data = argument;
+            oscFormatArgument->size = stringEnd - argument;
+            argumentSize = (oscFormatArgument->size + 4) & ~(size_t) 3;
+            break;
+        }
+        case OscTypeTagBlob:
+        {
+            if (bytesAvailable < sizeof (OscArgument32)) {
+                return OscErrorMessageTooShortForArgumentType; // error: message too short to contain argument
+            }
+            const OscArgument32 blobSize = OscFormatReadArgument32(argument);
+            if ((blobSize.int32 < 0) || ((size_t) blobSize.int32 > (bytesAvailable - sizeof (OscArgument32)))) {
+                return OscErrorMessageTooShortForArgumentType; // error: message too short to contain argument
+            }
+            oscFormatArgument->data = &argument[sizeof (OscArgument32)];
+            oscFormatArgument->size = (size_t) blobSize.int32;
+            argumentSize = sizeof (OscArgument32) + ((oscFormatArgument->size + 3) & ~(size_t) 3);
+            break;
+        }
+        case OscTypeTagTrue:
+        case OscTypeTagFalse:
+        case OscTypeTagNil:
+        case OscTypeTagInfinitum:
+        case OscTypeTagBeginArray:
+        case OscTypeTagEndArray:
+            argumentSize = 0;
+            oscFormatArgument->data = argument;
+            oscFormatArgument->size = 0;
+            break;
+        default:
+            return OscErrorUnknownTypeTag; // error: type tag string contains unknown type tag
+    }
+    if (argumentSize > bytesAvailable) {
+        return OscErrorMessageTooShortForArgumentType; // error: message too short to contain argument
+    }
+    oscFormatArgument->typeTag = typeTag;
+    oscFormatMessage->sourceIndex += argumentSize;
+    oscFormatMessage->typeTagIndex++;
+    return OscErrorNone;
+}
+
+//------------------------------------------------------------------------------
+// End of file
@@ -0,0 +1,88 @@
+/**
+ * @file OscFormat.h
+ * @author Seb Madgwick
+ * @brief Functions and structures used internally by the OscText and OscJson
+ * modules to read serialised OSC messages and to write serialised OSC contents
+ * and text to a fixed-size destination.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_FORMAT_H
+#define OSC_FORMAT_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscMessage.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief OSC format writer structure.  Writing stops once the destination is
+ * full.  Structure members are used internally and should not be used by the
+ * user application.
+ */
+typedef struct {
+    char * destination;
+    size_t destinationSize;
+    size_t size;
+    bool isFull;
+} OscFormatWriter;
+
+/**
+ * @brief OSC format message structure for reading the arguments of a
+ * serialised OSC message.  Structure members are used internally and should
+ * not be used by the user application.
+ */
+typedef struct {
+    const char * source;
+    size_t numberOfBytes;
+    const char * oscAddressPattern;
+    size_t oscAddressPatternLength;
+    const char * oscTypeTagString; // includes comma.  Not null terminated
+    size_t oscTypeTagStringLength; // includes comma
+    size_t typeTagIndex;
+    size_t sourceIndex;
+} OscFormatMessage;
+
+/**
+ * @brief OSC format argument structure.  The data is the argument for a 32-bit
+ * or 64-bit argument, the characters of a string argument without the
+ * terminating null character, the bytes of a blob argument without the size,
+ * or has a size of zero for an argument without data.
+ */
+typedef struct {
+    OscTypeTag typeTag;
+    const char * data;
+    size_t size;
+} OscFormatArgument;
+
+//------------------------------------------------------------------------------
+// Variable declarations
+
+extern const char oscFormatHexadecimalDigits[];
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+void OscFormatWriterInitialise(OscFormatWriter * const oscFormatWriter, char * const destination, const size_t destinationSize);
+void OscFormatWriterWrite(OscFormatWriter * const oscFormatWriter, const char * const source, const size_t numberOfBytes);
+void OscFormatWriterWritePadding(OscFormatWriter * const oscFormatWriter);
+void OscFormatWriteInt32(char * const destination, const int32_t int32);
+OscArgument32 OscFormatReadArgument32(const char * const source);
+OscArgument64 OscFormatReadArgument64(const char * const source);
+unsigned int OscFormatGetHexadecimalValue(const char character);
+OscError OscFormatMessageInitialise(OscFormatMessage * const oscFormatMessage, const char * const source, const size_t numberOfBytes);
+bool OscFormatMessageIsArgumentAvailable(const OscFormatMessage * const oscFormatMessage);
+OscError OscFormatMessageGetArgument(OscFormatMessage * const oscFormatMessage, OscFormatArgument * const oscFormatArgument);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
@@ -0,0 +1,373 @@
+/**
+ * @file OscHash.c
+ * @author Seb Madgwick
+ * @brief Functions for hashing and comparing OSC messages and OSC packets.
+ * Hashes are calculated from the serialised bytes so that wire-equivalent OSC
+ * messages have the same hash regardless of how they were constructed.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscHash.h"
+#include <string.h> // memcmp
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Initial hash value.
+ */
+#define HASH_SEED (0x9E3779B97F4A7C15ull)
+
+/**
+ * @brief Hash state structure.
+ */
+typedef struct {
+    uint64_t hash;
+    uint64_t pendingWord; // bytes not yet forming a complete word
+    unsigned int pendingSize;
+    size_t totalSize;
+} HashState;
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static void HashInitialise(HashState * const hashState);
+static void HashUpdate(HashState * const hashState, const char * const source, const size_t numberOfBytes);
+static void HashUpdatePadded(HashState * const hashState, const char * const string, const size_t length);
+static uint64_t HashFinalise(HashState * const hashState);
+static uint64_t MixWord(const uint64_t hash, uint64_t word);
+static void HashMessagePrefix(HashState * const hashState, const OscMessage * const oscMessage);
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Returns the hash of a byte array.
+ *
+ * The byte array is processed eight bytes at a time as little-endian 64-bit
+ * words so that the hash is the same on every platform.
+ *
+ * Example use:
+ * @code
+ * const uint64_t hash = OscHashBytes(source, numberOfBytes);
+ * @endcode
+ *
+ * @param source Byte array.
+ * @param numberOfBytes Number of bytes within the byte array.
+ * @return Hash of the byte array.
+ */
+uint64_t OscHashBytes(const void * const source, const size_t numberOfBytes) {
+    HashState hashState;
+    HashInitialise(&hashState);
+    HashUpdate(&hashState, (const char *) source, numberOfBytes);
+    return HashFinalise(&hashState);
+}
+
+/**
+ * @brief Returns the hash of the OSC address pattern of an OSC message.
+ *
+ * The hash is equal to OscHashBytes of the OSC address pattern excluding the
+ * terminating null character.
+ *
+ * Example use:
+ * @code
+ * const uint64_t hash = OscHashAddress(&oscMessage);
+ * @endcode
+ *
+ * @param oscMessage OSC message.
+ * @return Hash of the OSC address pattern.
+ */
+uint64_t OscHashAddress(const OscMessage * const oscMessage) {
+    return OscHashBytes(oscMessage->oscAddressPattern, oscMessage->oscAddressPatternLength);
+}
+
+/**
+ * @brief Returns the hash of the OSC address pattern and OSC type tag string
+ * of an OSC message.
+ *
+ * The hash is equal to OscHashBytes of the serialised OSC address pattern and
+ * OSC type tag string, including padding, at the start of the serialised OSC
+ * message.
+ *
+ * Example use:
+ * @code
+ * const uint64_t hash = OscHashAddressAndSignature(&oscMessage);
+ * @endcode
+ *
+ * @param oscMessage OSC message.
+ * @return Hash of the OSC address pattern and OSC type tag string.
+ */
+uint64_t OscHashAddressAndSignature(const OscMessage * const oscMessage) {
+    HashState hashState;
+    HashInitialise(&hashState);
+    HashMessagePrefix(&hashState, oscMessage);
+    return HashFinalise(&hashState);
+}
+
+/**
+ * @brief Returns the hash of an OSC message.
+ *
+ * The hash is equal to OscHashBytes of the serialised OSC message but is
+ * calculated without serialising the OSC message.
+ *
+ * Example use:
+ * @code
+ * const uint64_t hash = OscHashMessage(&oscMessage);
+ * @endcode
+ *
+ * @param oscMessage OSC message.
+ * @return Hash of the OSC message.
+ */
+uint64_t OscHashMessage(const OscMessage * const oscMessage) {
+    HashState hashState;
+    HashInitialise(&hashState);
+    HashMessagePrefix(&hashState, oscMessage);
+    HashUpdate(&hashState, oscMessage->arguments, oscMessage->argumentsSize);
+    return HashFinalise(&hashState);
+}
+
+/**
+ * @brief Returns the hash of an OSC packet.
+ *
+ * Example use:
+ * @code
+ * const uint64_t hash = OscHashPacket(&oscPacket);
+ * @endcode
+ *
+ * @param oscPacket OSC packet.
+ * @return Hash of the OSC packet.
+ */
+uint64_t OscHashPacket(const OscPacket * const oscPacket) {
+    return OscHashBytes(oscPacket->contents, oscPacket->size);
+}
+
+/**
+ * @brief Returns true if two OSC messages have the same OSC address pattern.
+ *
+ * Example use:
+ * @code
+ * if(OscHashIsAddressEqual(&oscMessageA, &oscMessageB) == true) {
+ *     printf("Same address");
+ * }
+ * @endcode
+ *
+ * @param oscMessageA First OSC message.
+ * @param oscMessageB Second OSC message.
+ * @return True if the OSC address patterns are equal.
+ */
+bool OscHashIsAddressEqual(const OscMessage * const oscMessageA, const OscMessage * const oscMessageB) {
+    if (oscMessageA->oscAddressPatternLength != oscMessageB->oscAddressPatternLength) {
+        return false;
+    }
+    return memcmp(oscMessageA->oscAddressPattern, oscMessageB->oscAddressPattern, oscMessageA->oscAddressPatternLength) == 0;
+}
+
+/**
+ * @brief Returns true if two OSC messages have the same OSC address pattern
+ * and OSC type tag string.
+ *
+ * Example use:
+ * @code
+ * if(OscHashIsAddressAndSignatureEqual(&oscMessageA, &oscMessageB) == true) {
+ *     printf("Same address and signature");
+ * }
+ * @endcode
+ *
+ * @param oscMessageA First OSC message.
+ * @param oscMessageB Second OSC message.
+ * @return True if the OSC address patterns and OSC type tag strings are equal.
+ */
+bool OscHashIsAddressAndSignatureEqual(const OscMessage * const oscMessageA, const OscMessage * const oscMessageB) {
+    if (oscMessageA->oscTypeTagStringLength != oscMessageB->oscTypeTagStringLength) {
+        return false;
+    }
+    if (memcmp(oscMessageA->oscTypeTagString, oscMessageB->oscTypeTagString, oscMessageA->oscTypeTagStringLength) != 0) {
+        return false;
+    }
+    return OscHashIsAddressEqual(oscMessageA, oscMessageB);
+}
+
+/**
+ * @brief Returns true if two OSC messages are wire-equivalent, that is, if
+ * they would serialise to the same bytes.
+ *
+ * Example use:
+ * @code
+ * if(OscHashIsMessageEqual(&oscMessageA, &oscMessageB) == true) {
+ *     printf("Duplicate message");
+ * }
+ * @endcode
+ *
+ * @param oscMessageA First OSC message.
+ * @param oscMessageB Second OSC message.
+ * @return True if the OSC messages are wire-equivalent.
+ */
+bool OscHashIsMessageEqual(const OscMessage * const oscMessageA, const OscMessage * const oscMessageB) {
+    if (oscMessageA->argumentsSize != oscMessageB->argumentsSize) {
+        return false;
+    }
+    if (memcmp(oscMessageA->arguments, oscMessageB->arguments, oscMessageA->argumentsSize) != 0) {
+        return false;
+    }
+    return OscHashIsAddressAndSignatureEqual(oscMessageA, oscMessageB);
+}
+
+/**
+ * @brief Returns true if two OSC packets have the same contents.
+ *
+ * Example use:
+ * @code
+ * if(OscHashIsPacketEqual(&oscPacketA, &oscPacketB) == true) {
+ *     printf("Duplicate packet");
+ * }
+ * @endcode
+ *
+ * @param oscPacketA First OSC packet.
+ * @param oscPacketB Second OSC packet.
+ * @return True if the OSC packets have the same contents.
+ */
+bool OscHashIsPacketEqual(const OscPacket * const oscPacketA, const OscPacket * const oscPacketB) {
+    if (oscPacketA->size != oscPacketB->size) {
+        return false;
+    }
+    return memcmp(oscPacketA->contents, oscPacketB->contents, oscPacketA->size) == 0;
+}
+
+/**
+ * @brief Initialises a hash state structure.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param hashState Hash state structure.
+ */
+static void HashInitialise(HashState * const hashState) {
+    hashState->hash = HASH_SEED;
+    hashState->pendingWord = 0;
+    hashState->pendingSize = 0;
+    hashState->totalSize = 0;
+}
+
+/**
+ * @brief Adds bytes to the hash.  Complete words are mixed directly from the
+ * source while any remaining bytes are held until the next update or
+ * finalisation.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param hashState Hash state structure.
+ * @param source Byte array.
+ * @param numberOfBytes Number of bytes within the byte array.
+ */
+static void HashUpdate(HashState * const hashState, const char * const source, const size_t numberOfBytes) {
+    const unsigned char * bytes = (const unsigned char *) source;
+    const unsigned char * const end = bytes + numberOfBytes;
+    hashState->totalSize += numberOfBytes;
+
+    // Complete pending word
+    while ((hashState->pendingSize != 0) && (bytes < end)) {
+        hashState->pendingWord |= (uint64_t) *bytes++ << (8 * hashState->pendingSize);
+        if (++hashState->pendingSize == sizeof (uint64_t)) {
+            hashState->hash = MixWord(hashState->hash, hashState->pendingWord);
+            hashState->pendingWord = 0;
+            hashState->pendingSize = 0;
+        }
+    }
+
+    // Mix complete words
+    while ((end - bytes) >= (ptrdiff_t) sizeof (uint64_t)) {
+        const uint64_t word = (uint64_t) bytes[0]
+                | ((uint64_t) bytes[1] << 8)
+                | ((uint64_t) bytes[2] << 16)
+                | ((uint64_t) bytes[3] << 24)
+                | ((uint64_t) bytes[4] << 32)
+                | ((uint64_t) bytes[5] << 40)
+                | ((uint64_t) bytes[6] << 48)
+                | ((uint64_t) bytes[7] << 56);
+        hashState->hash = MixWord(hashState->hash, word);
+        bytes += sizeof (uint64_t);
+    }
+
+    // Hold remaining bytes
+    while (bytes < end) {
+        hashState->pendingWord |= (uint64_t) *bytes++ << (8 * hashState->pendingSize);
+        hashState->pendingSize++;
+    }
+}
+
+/**
+ * @brief Adds a string to the hash followed by one to four null characters,
+ * as the string would be serialised within an OSC message.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param hashState Hash state structure.
+ * @param string String.
+ * @param length Length of the string excluding the terminating null character.
+ */
+static void HashUpdatePadded(HashState * const hashState, const char * const string, const size_t length) {
+    static const char nullCharacters[4] = {0, 0, 0, 0};
+    HashUpdate(hashState, string, length);
+    HashUpdate(hashState, nullCharacters, 4 - (length % 4));
+}
+
+/**
+ * @brief Returns the final hash.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param hashState Hash state structure.
+ * @return Hash.
+ */
+static uint64_t HashFinalise(HashState * const hashState) {
+    uint64_t hash = hashState->hash;
+    if (hashState->pendingSize != 0) {
+        hash = MixWord(hash, hashState->pendingWord);
+    }
+    hash ^= (uint64_t) hashState->totalSize;
+
+    // MurmurHash3 64-bit finaliser
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/**
+ * @brief Mixes a 64-bit word into the hash.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param hash Hash.
+ * @param word Word.
+ * @return Hash.
+ */
+static uint64_t MixWord(const uint64_t hash, uint64_t word) {
+    word *= 0x87C37B91114253D5ull;
+    word = (word << 31) | (word >> 33);
+    word *= 0x4CF5AD432745937Full;
+    uint64_t mixed = hash ^ word;
+    mixed = (mixed << 27) | (mixed >> 37);
+    return (mixed * 5) + 0x52DCE729;
+}
+
+/**
+ * @brief Adds the serialised OSC address pattern and OSC type tag string of an
+ * OSC message to the hash.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param hashState Hash state structure.
+ * @param oscMessage OSC message.
+ */
+static void HashMessagePrefix(HashState * const hashState, const OscMessage * const oscMessage) {
+    HashUpdatePadded(hashState, oscMessage->oscAddressPattern, oscMessage->oscAddressPatternLength);
+    HashUpdatePadded(hashState, oscMessage->oscTypeTagString, oscMessage->oscTypeTagStringLength);
+}
+
+//------------------------------------------------------------------------------
+// End of file
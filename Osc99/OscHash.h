@@ -0,0 +1,38 @@
+/**
+ * @file OscHash.h
+ * @author Seb Madgwick
+ * @brief Functions for hashing and comparing OSC messages and OSC packets.
+ * Hashes are calculated from the serialised bytes so that wire-equivalent OSC
+ * messages have the same hash regardless of how they were constructed.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_HASH_H
+#define OSC_HASH_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscMessage.h"
+#include "OscPacket.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+uint64_t OscHashBytes(const void * const source, const size_t numberOfBytes);
+uint64_t OscHashAddress(const OscMessage * const oscMessage);
+uint64_t OscHashAddressAndSignature(const OscMessage * const oscMessage);
+uint64_t OscHashMessage(const OscMessage * const oscMessage);
+uint64_t OscHashPacket(const OscPacket * const oscPacket);
+bool OscHashIsAddressEqual(const OscMessage * const oscMessageA, const OscMessage * const oscMessageB);
+bool OscHashIsAddressAndSignatureEqual(const OscMessage * const oscMessageA, const OscMessage * const oscMessageB);
+bool OscHashIsMessageEqual(const OscMessage * const oscMessageA, const OscMessage * const oscMessageB);
+bool OscHashIsPacketEqual(const OscPacket * const oscPacketA, const OscPacket * const oscPacketB);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
@@ -0,0 +1,1491 @@
+/**
+ * @file OscJson.c
+ * @author Seb Madgwick
+ * @brief Functions for converting between OSC packets and JSON.  Each OSC
+ * message is represented by a JSON object containing the OSC address pattern,
+ * the OSC type tag string, and an array of the arguments, for example:
+ * {"a":"/example","t":",ifs","v":[1,2.5,"text"]}
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include <math.h> // INFINITY, isinf, isnan, NAN
+#include "OscBundle.h"
+#include "OscFormat.h"
+#include "OscJson.h"
+#include "OscText.h"
+#include <string.h> // memchr, memcmp, memcpy, memmove, memset
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Maximum depth of nested OSC bundles parsed from JSON.  Limits the
+ * recursion of the parser.
+ */
+#define MAX_JSON_BUNDLE_DEPTH (8)
+
+/**
+ * @brief JSON reader structure.
+ */
+typedef struct {
+    const char * json;
+    size_t jsonSize;
+    size_t jsonIndex;
+} JsonReader;
+
+/**
+ * @brief Base64 characters.
+ */
+static const char base64Characters[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static OscError FormatContents(OscFormatWriter * const writer, const char * const oscContents, const size_t contentsSize);
+static OscError FormatMessage(OscFormatWriter * const writer, const char * const source, const size_t numberOfBytes);
+static void WriteString(OscFormatWriter * const writer, const char * const source, const size_t numberOfBytes);
+static size_t GetUtf8CharacterLength(const char * const source, const size_t numberOfBytes);
+static void WriteBase64(OscFormatWriter * const writer, const char * const source, const size_t numberOfBytes);
+static void WriteTimeTag(OscFormatWriter * const writer, const OscTimeTag oscTimeTag);
+static void WriteNonFinite(OscFormatWriter * const writer, const double value);
+static OscError ParseContents(JsonReader * const jsonReader, OscFormatWriter * const writer, const unsigned int depth);
+static OscError ParseElements(JsonReader * const jsonReader, OscFormatWriter * const writer, const unsigned int depth);
+static OscError ParseValues(JsonReader * const jsonReader, OscFormatWriter * const writer, const char * const oscTypeTagString, const size_t typeTagStringLength);
+static OscError ParseValue(JsonReader * const jsonReader, OscFormatWriter * const writer, const char typeTag);
+static char InferTypeTag(const JsonReader * const jsonReader);
+static void SkipWhitespace(JsonReader * const jsonReader);
+static bool ParseCharacter(JsonReader * const jsonReader, const char character);
+static bool ParseLiteral(JsonReader * const jsonReader, const char * const literal);
+static bool ParseRawString(JsonReader * const jsonReader, const char * * const string, size_t * const stringLength);
+static bool ParseString(JsonReader * const jsonReader, OscFormatWriter * const writer);
+static bool ParseBase64(JsonReader * const jsonReader, OscFormatWriter * const writer, size_t * const numberOfBytes);
+static bool ParseNonFinite(JsonReader * const jsonReader, double * const value);
+static size_t GetNumberEnd(const JsonReader * const jsonReader);
+static bool SkipValue(JsonReader * const jsonReader);
+static bool IsKey(const char * const key, const size_t keyLength, const char * const name);
+static unsigned int GetBase64Value(const char character);
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Formats an OSC packet as JSON.
+ *
+ * An OSC message is written as a JSON object containing the OSC address
+ * pattern, the OSC type tag string, and an array of the arguments, for
+ * example: {"a":"/example","t":",ifs","v":[1,2.5,"text"]}.  An OSC bundle is
+ * written as a JSON object containing the OSC time tag and an array of the OSC
+ * bundle elements, for example: {"tt":"83AA7E80.00000000","e":[...]}.  The
+ * JSON is not null terminated.
+ *
+ * Integers, floats, 32-bit RGBA colours, and 4 byte MIDI messages are written
+ * as numbers.  A float that is not finite is written as the string "NaN",
+ * "Infinity", or "-Infinity".  Strings and characters are written as strings.
+ * A byte that is not part of a valid UTF-8 character is written as \u0080 to
+ * \u00FF so that the JSON remains valid UTF-8.  Blobs are written as base64
+ * strings.  OSC time tags are written as strings in the same format as the OSC
+ * time tag of an OSC bundle.  True, false, nil, and infinitum are written as
+ * true, false, null, and null.  Arrays are written as arrays.  An OSC message
+ * with unbalanced array type tags cannot be formatted.
+ *
+ * Example use:
+ * @code
+ * char json[4096];
+ * size_t jsonSize;
+ * if(OscJsonFormatPacket(&oscPacket, &jsonSize, json, sizeof(json)) == OscErrorNone) {
+ *     MyWebSocketSend(json, jsonSize);
+ * }
+ * @endcode
+ *
+ * @param oscPacket OSC packet to be formatted.
+ * @param jsonSize Size of the JSON.
+ * @param destination Destination address of the JSON.
+ * @param destinationSize Size of the destination.
+ * @return Error code (0 if successful).
+ */
+OscError OscJsonFormatPacket(const OscPacket * const oscPacket, size_t * const jsonSize, char * const destination, const size_t destinationSize) {
+    return OscJsonFormatContents(oscPacket->contents, oscPacket->size, jsonSize, destination, destinationSize);
+}
+
+/**
+ * @brief Formats OSC contents as JSON.
+ *
+ * This function is equivalent to OscJsonFormatPacket and may be used to format
+ * an OSC message or OSC bundle that has been received into a buffer without
+ * first copying it to an OSC packet.
+ *
+ * Example use:
+ * @code
+ * OscJsonFormatContents(myBuffer, myBufferSize, &jsonSize, json, sizeof(json));
+ * @endcode
+ *
+ * @param oscContents OSC message or OSC bundle to be formatted.
+ * @param contentsSize Size of the OSC contents.
+ * @param jsonSize Size of the JSON.
+ * @param destination Destination address of the JSON.
+ * @param destinationSize Size of the destination.
+ * @return Error code (0 if successful).
+ */
+OscError OscJsonFormatContents(const void * const oscContents, const size_t contentsSize, size_t * const jsonSize, char * const destination, const size_t destinationSize) {
+    *jsonSize = 0; // size will be 0 if function unsuccessful
+    OscFormatWriter writer;
+    OscFormatWriterInitialise(&writer, destination, destinationSize);
+    const OscError oscError = FormatContents(&writer, (const char *) oscContents, contentsSize);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    if (writer.isFull == true) {
+        return OscErrorDestinationTooSmall; // error: destination too small
+    }
+    *jsonSize = writer.size;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Parses a JSON object as an OSC packet.
+ *
+ * This function is equivalent to OscJsonParseContents and writes the OSC
+ * contents to an OSC packet.
+ *
+ * Example use:
+ * @code
+ * OscPacket oscPacket;
+ * OscPacketInitialise(&oscPacket);
+ * size_t jsonParsed;
+ * if(OscJsonParsePacket(json, jsonSize, &jsonParsed, &oscPacket) == OscErrorNone) {
+ *     OscPacketProcessMessages(&oscPacket);
+ * }
+ * @endcode
+ *
+ * @param json JSON to be parsed.
+ * @param jsonSize Size of the JSON.
+ * @param jsonParsed Size of the JSON parsed.
+ * @param oscPacket OSC packet.
+ * @return Error code (0 if successful).
+ */
+OscError OscJsonParsePacket(const char * const json, const size_t jsonSize, size_t * const jsonParsed, OscPacket * const oscPacket) {
+    size_t contentsSize;
+    const OscError oscError = OscJsonParseContents(json, jsonSize, jsonParsed, &contentsSize, oscPacket->contents, sizeof (oscPacket->contents));
+    if (oscError == OscErrorDestinationTooSmall) {
+        return OscErrorPacketSizeTooLarge; // error: OSC packet too large
+    }
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    oscPacket->size = contentsSize;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Parses a JSON object as OSC contents.
+ *
+ * The JSON object is parsed in the format written by OscJsonFormatPacket in a
+ * single pass.  The OSC contents are written directly to the destination.  The
+ * OSC address pattern must precede the OSC type tag string and arguments, and
+ * the OSC time tag must precede the OSC bundle elements.  The OSC type tag
+ * string is optional.  If the OSC type tag string is omitted then the type of
+ * each argument is determined by the JSON value: a number without a fraction
+ * or exponent is an int32 or int64, any other number is a float, and a string
+ * is a string.  The arguments may be omitted if the OSC type tag string only
+ * contains type tags without data, for example: {"a":"/example","t":",T"}.
+ * Other members of the JSON object are ignored.  Escaped characters are not
+ * supported in member names, OSC type tag strings, OSC time tags, or base64
+ * strings.  The escape sequences \u0080 to \u00FF are parsed as single bytes
+ * so that strings written by OscJsonFormatPacket are parsed unchanged.
+ *
+ * The JSON parsed indicates the end of the JSON object, including any trailing
+ * whitespace, so that a stream of JSON objects may be parsed one at a time.
+ *
+ * Example use:
+ * @code
+ * char contents[MAX_OSC_PACKET_SIZE];
+ * size_t jsonParsed;
+ * size_t contentsSize;
+ * size_t jsonIndex = 0;
+ * while (jsonIndex < jsonSize) {
+ *     if (OscJsonParseContents(&json[jsonIndex], jsonSize - jsonIndex, &jsonParsed, &contentsSize, contents, sizeof(contents)) != OscErrorNone) {
+ *         break;
+ *     }
+ *     MySend(contents, contentsSize);
+ *     jsonIndex += jsonParsed;
+ * }
+ * @endcode
+ *
+ * @param json JSON to be parsed.
+ * @param jsonSize Size of the JSON.
+ * @param jsonParsed Size of the JSON parsed.
+ * @param contentsSize Size of the OSC contents.
+ * @param destination Destination address of the OSC contents.
+ * @param destinationSize Size of the destination.
+ * @return Error code (0 if successful).
+ */
+OscError OscJsonParseContents(const char * const json, const size_t jsonSize, size_t * const jsonParsed, size_t * const contentsSize, char * const destination, const size_t destinationSize) {
+    *jsonParsed = 0; // size will be 0 if function unsuccessful
+    *contentsSize = 0;
+    JsonReader jsonReader;
+    jsonReader.json = json;
+    jsonReader.jsonSize = jsonSize;
+    jsonReader.jsonIndex = 0;
+    OscFormatWriter writer;
+    OscFormatWriterInitialise(&writer, destination, destinationSize);
+    const OscError oscError = ParseContents(&jsonReader, &writer, 0);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    if (writer.isFull == true) {
+        return OscErrorDestinationTooSmall; // error: destination too small
+    }
+    SkipWhitespace(&jsonReader);
+    *jsonParsed = jsonReader.jsonIndex;
+    *contentsSize = writer.size;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Recursively formats OSC contents as JSON.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param writer OscFormatWriter structure.
+ * @param oscContents OSC contents.
+ * @param contentsSize Size of the OSC contents.
+ * @return Error code (0 if successful).
+ */
+static OscError FormatContents(OscFormatWriter * const writer, const char * const oscContents, const size_t contentsSize) {
+    if (contentsSize == 0) {
+        return OscErrorContentsEmpty; // error: contents empty
+    }
+
+    // Contents is an OSC message
+    if (OscContentsIsMessage(oscContents) == true) {
+        return FormatMessage(writer, oscContents, contentsSize);
+    }
+
+    // Contents is an OSC bundle
+    if (OscContentsIsBundle(oscContents) == true) {
+        if (contentsSize < MIN_OSC_BUNDLE_SIZE) {
+            return OscErrorBundleSizeTooSmall; // error: too few bytes to contain bundle
+        }
+        if ((contentsSize % 4) != 0) {
+            return OscErrorSizeIsNotMultipleOfFour; // error: size not multiple of 4
+        }
+        size_t contentsIndex = sizeof (OSC_BUNDLE_HEADER);
+        OscTimeTag oscTimeTag;
+        oscTimeTag.value = OscFormatReadArgument64(&oscContents[contentsIndex]).int64;
+        contentsIndex += sizeof (OscTimeTag);
+        OscFormatWriterWrite(writer, "{\"tt\":", 6);
+        WriteTimeTag(writer, oscTimeTag);
+        OscFormatWriterWrite(writer, ",\"e\":[", 6);
+        while (contentsIndex < contentsSize) {
+            if ((contentsIndex + sizeof (OscArgument32)) > contentsSize) {
+                return OscErrorBundleElementNotAvailable; // error: too few bytes to contain bundle element size
+            }
+            const OscArgument32 elementSize = OscFormatReadArgument32(&oscContents[contentsIndex]);
+            if (contentsIndex != (sizeof (OSC_BUNDLE_HEADER) + sizeof (OscTimeTag))) {
+                OscFormatWriterWrite(writer, ",", 1);
+            }
+            contentsIndex += sizeof (OscArgument32);
+            if (elementSize.int32 < 0) {
+                return OscErrorNegativeBundleElementSize; // error: size cannot be negative
+            }
+            if ((elementSize.int32 % 4) != 0) {
+                return OscErrorSizeIsNotMultipleOfFour; // error: size not multiple of 4
+            }
+            if ((contentsIndex + elementSize.int32) > contentsSize) {
+                return OscErrorInvalidElementSize; // error: too few bytes for indicated size
+            }
+            const OscError oscError = FormatContents(writer, &oscContents[contentsIndex], elementSize.int32); // recursive formatting
+            if (oscError != OscErrorNone) {
+                return oscError;
+            }
+            contentsIndex += elementSize.int32;
+        }
+        OscFormatWriterWrite(writer, "]}", 2);
+        return OscErrorNone;
+    }
+
+    return OscErrorInvalidContents; // error: invalid or uninitialised contents
+}
+
+/**
+ * @brief Formats a serialised OSC message as JSON.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param writer OscFormatWriter structure.
+ * @param source Serialised OSC message.
+ * @param numberOfBytes Size of the serialised OSC message.
+ * @return Error code (0 if successful).
+ */
+static OscError FormatMessage(OscFormatWriter * const writer, const char * const source, const size_t numberOfBytes) {
+    OscFormatMessage oscFormatMessage;
+    OscError oscError = OscFormatMessageInitialise(&oscFormatMessage, source, numberOfBytes);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+
+    // OSC address pattern and OSC type tag string
+    OscFormatWriterWrite(writer, "{\"a\":", 5);
+    WriteString(writer, oscFormatMessage.oscAddressPattern, oscFormatMessage.oscAddressPatternLength);
+    OscFormatWriterWrite(writer, ",\"t\":", 5);
+    WriteString(writer, oscFormatMessage.oscTypeTagString, oscFormatMessage.oscTypeTagStringLength);
+
+    // Arguments
+    OscFormatWriterWrite(writer, ",\"v\":[", 6);
+    bool isFirstValue = true;
+    unsigned int arrayDepth = 0;
+    while (OscFormatMessageIsArgumentAvailable(&oscFormatMessage) == true) {
+        OscFormatArgument argument;
+        oscError = OscFormatMessageGetArgument(&oscFormatMessage, &argument);
+        if (oscError != OscErrorNone) {
+            return oscError;
+        }
+        if (argument.typeTag == OscTypeTagEndArray) {
+            if (arrayDepth == 0) {
+                return OscErrorUnbalancedJsonArray; // error: end of array without beginning
+            }
+            arrayDepth--;
+            OscFormatWriterWrite(writer, "]", 1);
+            isFirstValue = false;
+            continue;
+        }
+        if (isFirstValue == false) {
+            OscFormatWriterWrite(writer, ",", 1);
+        }
+        isFirstValue = false;
+        char text[MAX_OSC_TEXT_NUMBER_LENGTH];
+        size_t textLength = 0;
+        switch (argument.typeTag) {
+            case OscTypeTagInt32:
+                textLength = OscTextFormatInt64(OscFormatReadArgument32(argument.data).int32, text);
+                break;
+            case OscTypeTagFloat32:
+            {
+                const float float32 = OscFormatReadArgument32(argument.data).float32;
+                if ((isnan(float32)) || (isinf(float32))) {
+                    WriteNonFinite(writer, float32);
+                    break;
+                }
+                textLength = OscTextFormatFloat32(float32, text);
+                break;
+            }
+            case OscTypeTagString:
+            case OscTypeTagAlternateString:
+                WriteString(writer, argument.data, argument.size);
+                break;
+            case OscTypeTagBlob:
+                WriteBase64(writer, argument.data, argument.size);
+                break;
+            case OscTypeTagInt64:
+                textLength = OscTextFormatInt64((int64_t) OscFormatReadArgument64(argument.data).int64, text);
+                break;
+            case OscTypeTagTimeTag:
+            {
+                OscTimeTag oscTimeTag;
+                oscTimeTag.value = OscFormatReadArgument64(argument.data).int64;
+                WriteTimeTag(writer, oscTimeTag);
+                break;
+            }
+            case OscTypeTagDouble:
+            {
+                const double double64 = (double) OscFormatReadArgument64(argument.data).double64;
+                if ((isnan(double64)) || (isinf(double64))) {
+                    WriteNonFinite(writer, double64);
+                    break;
+                }
+                textLength = OscTextFormatDouble(double64, text);
+                break;
+            }
+            case OscTypeTagCharacter:
+                WriteString(writer, &argument.data[3], 1);
+                break;
+            case OscTypeTagRgbaColour:
+            case OscTypeTagMidiMessage:
+                textLength = OscTextFormatInt64((uint32_t) OscFormatReadArgument32(argument.data).int32, text);
+                break;
+            case OscTypeTagTrue:
+                OscFormatWriterWrite(writer, "true", 4);
+                break;
+            case OscTypeTagFalse:
+                OscFormatWriterWrite(writer, "false", 5);
+                break;
+            case OscTypeTagNil:
+            case OscTypeTagInfinitum:
+                OscFormatWriterWrite(writer, "null", 4);
+                break;
+            case OscTypeTagBeginArray:
+            default:
+                arrayDepth++;
+                OscFormatWriterWrite(writer, "[", 1);
+                isFirstValue = true;
+                break;
+        }
+        OscFormatWriterWrite(writer, text, textLength);
+    }
+    if (arrayDepth != 0) {
+        return OscErrorUnbalancedJsonArray; // error: array without end
+    }
+    OscFormatWriterWrite(writer, "]}", 2);
+    return OscErrorNone;
+}
+
+/**
+ * @brief Writes a JSON string.  A quote or backslash is preceded by a
+ * backslash and any control character or byte that is not part of a valid UTF-8
+ * character is written as an escape sequence.  Other characters are written
+ * unchanged.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param writer OscFormatWriter structure.
+ * @param source String.
+ * @param numberOfBytes Length of the string.
+ */
+static void WriteString(OscFormatWriter * const writer, const char * const source, const size_t numberOfBytes) {
+    OscFormatWriterWrite(writer, "\"", 1);
+    size_t runStart = 0; // start of characters that do not require escaping
+    size_t sourceIndex;
+    for (sourceIndex = 0; sourceIndex < numberOfBytes; sourceIndex++) {
+        const unsigned char character = (unsigned char) source[sourceIndex];
+        if ((character >= ' ') && (character != '"') && (character != '\\')) {
+            if (character < 0x80) {
+                continue;
+            }
+            const size_t characterLength = GetUtf8CharacterLength(&source[sourceIndex], numberOfBytes - sourceIndex);
+            if (characterLength > 0) {
+                sourceIndex += characterLength - 1;
+                continue;
+            }
+        }
+        OscFormatWriterWrite(writer, &source[runStart], sourceIndex - runStart);
+        runStart = sourceIndex + 1;
+        switch (character) {
+            case '"':
+                OscFormatWriterWrite(writer, "\\\"", 2);
+                break;
+            case '\\':
+                OscFormatWriterWrite(writer, "\\\\", 2);
+                break;
+            case '\n':
+                OscFormatWriterWrite(writer, "\\n", 2);
+                break;
+            case '\r':
+                OscFormatWriterWrite(writer, "\\r", 2);
+                break;
+            case '\t':
+                OscFormatWriterWrite(writer, "\\t", 2);
+                break;
+            default:
+            {
+                const char escaped[6] = {'\\', 'u', '0', '0', oscFormatHexadecimalDigits[character >> 4], oscFormatHexadecimalDigits[character & 0xF]};
+                OscFormatWriterWrite(writer, escaped, sizeof (escaped));
+                break;
+            }
+        }
+    }
+    OscFormatWriterWrite(writer, &source[runStart], numberOfBytes - runStart);
+    OscFormatWriterWrite(writer, "\"", 1);
+}
+
+/**
+ * @brief Returns the length of the UTF-8 character at the start of the source.
+ * Overlong encodings, surrogates, and code points above U+10FFFF are not valid
+ * UTF-8 characters.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param source Source.
+ * @param numberOfBytes Number of bytes available in the source.
+ * @return Length of the UTF-8 character, or 0 if the source does not start with
+ * a valid UTF-8 character.
+ */
+static size_t GetUtf8CharacterLength(const char * const source, const size_t numberOfBytes) {
+    const unsigned char leadByte = (unsigned char) source[0];
+    unsigned char minimum = 0x80; // range of next continuation byte
+    unsigned char maximum = 0xBF;
+    size_t characterLength;
+    if (leadByte < 0x80) {
+        return 1;
+    } else if ((leadByte >= 0xC2) && (leadByte <= 0xDF)) {
+        characterLength = 2;
+    } else if ((leadByte >= 0xE0) && (leadByte <= 0xEF)) {
+        characterLength = 3;
+        if (leadByte == 0xE0) {
+            minimum = 0xA0; // overlong
+        } else if (leadByte == 0xED) {
+            maximum = 0x9F; // surrogate
+        }
+    } else if ((leadByte >= 0xF0) && (leadByte <= 0xF4)) {
+        characterLength = 4;
+        if (leadByte == 0xF0) {
+            minimum = 0x90; // overlong
+        } else if (leadByte == 0xF4) {
+            maximum = 0x8F; // above U+10FFFF
+        }
+    } else {
+        return 0;
+    }
+    if (characterLength > numberOfBytes) {
+        return 0;
+    }
+    size_t byteIndex;
+    for (byteIndex = 1; byteIndex < characterLength; byteIndex++) {
+        const unsigned char continuationByte = (unsigned char) source[byteIndex];
+        if ((continuationByte < minimum) || (continuationByte > maximum)) {
+            return 0;
+        }
+        minimum = 0x80;
+        maximum = 0xBF;
+    }
+    return characterLength;
+}
+
+/**
+ * @brief Writes bytes as a base64 JSON string.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param writer OscFormatWriter structure.
+ * @param source Bytes.
+ * @param numberOfBytes Number of bytes.
+ */
+static void WriteBase64(OscFormatWriter * const writer, const char * const source, const size_t numberOfBytes) {
+    OscFormatWriterWrite(writer, "\"", 1);
+    const size_t encodedSize = ((numberOfBytes + 2) / 3) * 4;
+    if ((writer->isFull == true) || ((writer->size + encodedSize) > writer->destinationSize)) {
+        writer->isFull = true;
+        return;
+    }
+    char * destination = &writer->destination[writer->size];
+    size_t sourceIndex;
+    for (sourceIndex = 0; (sourceIndex + 3) <= numberOfBytes; sourceIndex += 3) {
+        const uint32_t group = ((uint32_t) (unsigned char) source[sourceIndex] << 16) | ((uint32_t) (unsigned char) source[sourceIndex + 1] << 8) | (unsigned char) source[sourceIndex + 2];
+        *destination++ = base64Characters[(group >> 18) & 0x3F];
+        *destination++ = base64Characters[(group >> 12) & 0x3F];
+        *destination++ = base64Characters[(group >> 6) & 0x3F];
+        *destination++ = base64Characters[group & 0x3F];
+    }
+    if (sourceIndex < numberOfBytes) {
+        const bool isTwoBytes = (sourceIndex + 2) == numberOfBytes;
+        const uint32_t group = ((uint32_t) (unsigned char) source[sourceIndex] << 16) | (isTwoBytes ? ((uint32_t) (unsigned char) source[sourceIndex + 1] << 8) : 0);
+        *destination++ = base64Characters[(group >> 18) & 0x3F];
+        *destination++ = base64Characters[(group >> 12) & 0x3F];
+        *destination++ = isTwoBytes ? base64Characters[(group >> 6) & 0x3F] : '=';
+        *destination++ = '=';
+    }
+    writer->size += encodedSize;
+    OscFormatWriterWrite(writer, "\"", 1);
+}
+
+/**
+ * @brief Writes an OSC time tag as a JSON string.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param writer OscFormatWriter structure.
+ * @param oscTimeTag OSC time tag.
+ */
+static void WriteTimeTag(OscFormatWriter * const writer, const OscTimeTag oscTimeTag) {
+    char text[MAX_OSC_TEXT_NUMBER_LENGTH];
+    OscFormatWriterWrite(writer, "\"", 1);
+    OscFormatWriterWrite(writer, text, OscTextFormatTimeTag(oscTimeTag, text));
+    OscFormatWriterWrite(writer, "\"", 1);
+}
+
+/**
+ * @brief Writes a value that is not finite as the JSON string "NaN",
+ * "Infinity", or "-Infinity".
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param writer OscFormatWriter structure.
+ * @param value Value.
+ */
+static void WriteNonFinite(OscFormatWriter * const writer, const double value) {
+    if (isnan(value)) {
+        OscFormatWriterWrite(writer, "\"NaN\"", 5);
+    } else if (value > 0) {
+        OscFormatWriterWrite(writer, "\"Infinity\"", 10);
+    } else {
+        OscFormatWriterWrite(writer, "\"-Infinity\"", 11);
+    }
+}
+
+/**
+ * @brief Recursively parses a JSON object as OSC contents.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @param writer OscFormatWriter structure.
+ * @param depth Depth of OSC bundles containing the OSC contents.
+ * @return Error code (0 if successful).
+ */
+static OscError ParseContents(JsonReader * const jsonReader, OscFormatWriter * const writer, const unsigned int depth) {
+    if (depth > MAX_JSON_BUNDLE_DEPTH) {
+        return OscErrorJsonBundleDepthTooLarge; // error: OSC bundles nested too deeply
+    }
+    if (ParseCharacter(jsonReader, '{') == false) {
+        return OscErrorInvalidJsonSyntax; // error: expected object
+    }
+    bool isMessage = false;
+    bool isBundle = false;
+    bool hasTypeTagString = false;
+    bool hasValues = false;
+    bool hasElements = false;
+    const char * typeTagString = NULL;
+    size_t typeTagStringLength = 0;
+    bool isFirstMember = true;
+    while (true) {
+        if (ParseCharacter(jsonReader, '}') == true) {
+            break;
+        }
+        if ((isFirstMember == false) && (ParseCharacter(jsonReader, ',') == false)) {
+            return OscErrorInvalidJsonSyntax; // error: expected comma
+        }
+        isFirstMember = false;
+        const char * key;
+        size_t keyLength;
+        SkipWhitespace(jsonReader);
+        if ((ParseRawString(jsonReader, &key, &keyLength) == false) || (ParseCharacter(jsonReader, ':') == false)) {
+            return OscErrorInvalidJsonSyntax; // error: expected member name
+        }
+        SkipWhitespace(jsonReader);
+
+        // OSC address pattern
+        if (IsKey(key, keyLength, "a") == true) {
+            if ((isMessage == true) || (isBundle == true)) {
+                return OscErrorInvalidJsonObject; // error: OSC address pattern must be first
+            }
+            isMessage = true;
+            const size_t addressStart = writer->size;
+            if (ParseString(jsonReader, writer) == false) {
+                return OscErrorInvalidJsonAddressPattern; // error: OSC address pattern must be string
+            }
+            if ((writer->isFull == false) && ((writer->size == addressStart) || (writer->destination[addressStart] != '/') || (memchr(&writer->destination[addressStart], '\0', writer->size - addressStart) != NULL))) {
+                return OscErrorInvalidJsonAddressPattern; // error: OSC address pattern must start with '/'
+            }
+            OscFormatWriterWrite(writer, "", 1);
+            OscFormatWriterWritePadding(writer);
+            continue;
+        }
+
+        // OSC type tag string
+        if (IsKey(key, keyLength, "t") == true) {
+            if ((isMessage == false) || (hasTypeTagString == true) || (hasValues == true)) {
+                return OscErrorInvalidJsonObject; // error: OSC type tag string must follow OSC address pattern
+            }
+            hasTypeTagString = true;
+            if ((ParseRawString(jsonReader, &typeTagString, &typeTagStringLength) == false) || (typeTagStringLength == 0) || (typeTagString[0] != ',')) {
+                return OscErrorInvalidJsonTypeTagString; // error: OSC type tag string must start with ','
+            }
+            OscFormatWriterWrite(writer, typeTagString, typeTagStringLength);
+            OscFormatWriterWrite(writer, "", 1);
+            OscFormatWriterWritePadding(writer);
+            continue;
+        }
+
+        // Arguments
+        if (IsKey(key, keyLength, "v") == true) {
+            if ((isMessage == false) || (hasValues == true)) {
+                return OscErrorInvalidJsonObject; // error: arguments must follow OSC address pattern
+            }
+            hasValues = true;
+            const OscError oscError = ParseValues(jsonReader, writer, typeTagString, typeTagStringLength);
+            if (oscError != OscErrorNone) {
+                return oscError;
+            }
+            continue;
+        }
+
+        // OSC time tag
+        if (IsKey(key, keyLength, "tt") == true) {
+            if ((isMessage == true) || (isBundle == true)) {
+                return OscErrorInvalidJsonObject; // error: OSC time tag must be first
+            }
+            isBundle = true;
+            const char * text;
+            size_t textLength;
+            OscTimeTag oscTimeTag;
+            if ((ParseRawString(jsonReader, &text, &textLength) == false) || (OscTextParseTimeTag(text, textLength, &oscTimeTag) == false)) {
+                return OscErrorInvalidJsonValue; // error: invalid OSC time tag
+            }
+            char timeTag[sizeof (OscTimeTag)];
+            OscFormatWriteInt32(timeTag, (int32_t) (oscTimeTag.value >> 32));
+            OscFormatWriteInt32(&timeTag[sizeof (OscArgument32)], (int32_t) oscTimeTag.value);
+            OscFormatWriterWrite(writer, OSC_BUNDLE_HEADER, sizeof (OSC_BUNDLE_HEADER));
+            OscFormatWriterWrite(writer, timeTag, sizeof (timeTag));
+            continue;
+        }
+
+        // OSC bundle elements
+        if (IsKey(key, keyLength, "e") == true) {
+            if ((isBundle == false) || (hasElements == true)) {
+                return OscErrorInvalidJsonObject; // error: OSC bundle elements must follow OSC time tag
+            }
+            hasElements = true;
+            const OscError oscError = ParseElements(jsonReader, writer, depth);
+            if (oscError != OscErrorNone) {
+                return oscError;
+            }
+            continue;
+        }
+
+        // Other members
+        if (SkipValue(jsonReader) == false) {
+            return OscErrorInvalidJsonSyntax; // error: invalid value
+        }
+    }
+    if (isBundle == true) {
+        return OscErrorNone;
+    }
+    if (isMessage == false) {
+        return OscErrorInvalidJsonObject; // error: no OSC address pattern or OSC time tag
+    }
+    if (hasValues == false) {
+        if (hasTypeTagString == false) {
+            OscFormatWriterWrite(writer, ",\0\0\0", 4);
+        } else {
+            size_t typeTagIndex;
+            for (typeTagIndex = 1; typeTagIndex < typeTagStringLength; typeTagIndex++) {
+                switch (typeTagString[typeTagIndex]) {
+                    case OscTypeTagTrue:
+                    case OscTypeTagFalse:
+                    case OscTypeTagNil:
+                    case OscTypeTagInfinitum:
+                    case OscTypeTagBeginArray:
+                    case OscTypeTagEndArray:
+                        break;
+                    default:
+                        return OscErrorTooFewJsonValues; // error: fewer values than type tags with data
+                }
+            }
+        }
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Parses a JSON array of OSC bundle elements.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @param writer OscFormatWriter structure.
+ * @param depth Depth of OSC bundles containing the OSC bundle.
+ * @return Error code (0 if successful).
+ */
+static OscError ParseElements(JsonReader * const jsonReader, OscFormatWriter * const writer, const unsigned int depth) {
+    if (ParseCharacter(jsonReader, '[') == false) {
+        return OscErrorInvalidJsonSyntax; // error: expected array
+    }
+    bool isFirstElement = true;
+    while (true) {
+        if (ParseCharacter(jsonReader, ']') == true) {
+            return OscErrorNone;
+        }
+        if ((isFirstElement == false) && (ParseCharacter(jsonReader, ',') == false)) {
+            return OscErrorInvalidJsonSyntax; // error: expected comma
+        }
+        isFirstElement = false;
+        const size_t elementSizeIndex = writer->size;
+        OscFormatWriterWrite(writer, "\0\0\0\0", sizeof (OscArgument32)); // written below
+        const OscError oscError = ParseContents(jsonReader, writer, depth + 1); // recursive parsing
+        if (oscError != OscErrorNone) {
+            return oscError;
+        }
+        if (writer->isFull == false) {
+            OscFormatWriteInt32(&writer->destination[elementSizeIndex], (int32_t) (writer->size - elementSizeIndex - sizeof (OscArgument32)));
+        }
+    }
+}
+
+/**
+ * @brief Parses a JSON array of arguments.  If the OSC type tag string is NULL
+ * then the type tags are determined by the JSON values and the OSC type tag
+ * string is inserted before the arguments.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @param writer OscFormatWriter structure.
+ * @param oscTypeTagString OSC type tag string.  NULL if not specified.
+ * @param typeTagStringLength Length of the OSC type tag string.
+ * @return Error code (0 if successful).
+ */
+static OscError ParseValues(JsonReader * const jsonReader, OscFormatWriter * const writer, const char * const oscTypeTagString, const size_t typeTagStringLength) {
+    if (ParseCharacter(jsonReader, '[') == false) {
+        return OscErrorInvalidJsonSyntax; // error: expected array
+    }
+    char inferredTypeTagString[MAX_OSC_TYPE_TAG_STRING_LENGTH + 1];
+    size_t inferredTypeTagStringLength = 0;
+    inferredTypeTagString[inferredTypeTagStringLength++] = ',';
+    const size_t argumentsStart = writer->size;
+    size_t typeTagIndex = 1; // skip comma
+    unsigned int arrayDepth = 0;
+    bool isFirstValue = true;
+    while (true) {
+        char typeTag;
+
+        // End of array
+        if (ParseCharacter(jsonReader, ']') == true) {
+            if (arrayDepth == 0) {
+                break;
+            }
+            arrayDepth--;
+            isFirstValue = false;
+            typeTag = OscTypeTagEndArray;
+        }
+
+        // Value
+        else {
+            if ((isFirstValue == false) && (ParseCharacter(jsonReader, ',') == false)) {
+                return OscErrorInvalidJsonSyntax; // error: expected comma
+            }
+            isFirstValue = false;
+            SkipWhitespace(jsonReader);
+            typeTag = InferTypeTag(jsonReader);
+            if (typeTag == '\0') {
+                return OscErrorInvalidJsonSyntax; // error: invalid value
+            }
+            if (oscTypeTagString != NULL) {
+                if (typeTagIndex >= typeTagStringLength) {
+                    return OscErrorTooManyJsonValues; // error: more values than type tags
+                }
+                typeTag = oscTypeTagString[typeTagIndex];
+            }
+            if (typeTag == OscTypeTagBeginArray) {
+                if (ParseCharacter(jsonReader, '[') == false) {
+                    return OscErrorInvalidJsonValue; // error: expected array
+                }
+                arrayDepth++;
+                isFirstValue = true;
+            } else if (typeTag == OscTypeTagEndArray) {
+                return OscErrorInvalidJsonValue; // error: expected end of array
+            } else {
+                const OscError oscError = ParseValue(jsonReader, writer, typeTag);
+                if (oscError != OscErrorNone) {
+                    return oscError;
+                }
+            }
+        }
+
+        // Check or append type tag
+        if (oscTypeTagString != NULL) {
+            if ((typeTagIndex >= typeTagStringLength) || (oscTypeTagString[typeTagIndex] != typeTag)) {
+                return OscErrorInvalidJsonValue; // error: array does not match type tag string
+            }
+            typeTagIndex++;
+            continue;
+        }
+        if (inferredTypeTagStringLength >= MAX_OSC_TYPE_TAG_STRING_LENGTH) {
+            return OscErrorTooManyArguments; // error: too many arguments
+        }
+        inferredTypeTagString[inferredTypeTagStringLength++] = typeTag;
+    }
+    if (oscTypeTagString != NULL) {
+        if (typeTagIndex != typeTagStringLength) {
+            return OscErrorTooFewJsonValues; // error: fewer values than type tags
+        }
+        return OscErrorNone;
+    }
+
+    // Insert OSC type tag string before arguments
+    const size_t typeTagStringSize = (inferredTypeTagStringLength + 4) & ~(size_t) 3;
+    if ((writer->isFull == true) || ((writer->size + typeTagStringSize) > writer->destinationSize)) {
+        writer->isFull = true;
+        return OscErrorNone;
+    }
+    char * const typeTagStringDestination = &writer->destination[argumentsStart];
+    memmove(&typeTagStringDestination[typeTagStringSize], typeTagStringDestination, writer->size - argumentsStart);
+    memcpy(typeTagStringDestination, inferredTypeTagString, inferredTypeTagStringLength);
+    memset(&typeTagStringDestination[inferredTypeTagStringLength], '\0', typeTagStringSize - inferredTypeTagStringLength);
+    writer->size += typeTagStringSize;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Parses a JSON value as an argument.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @param writer OscFormatWriter structure.
+ * @param typeTag Type tag of the argument.
+ * @return Error code (0 if successful).
+ */
+static OscError ParseValue(JsonReader * const jsonReader, OscFormatWriter * const writer, const char typeTag) {
+    const char * const number = &jsonReader->json[jsonReader->jsonIndex];
+    const size_t numberLength = GetNumberEnd(jsonReader) - jsonReader->jsonIndex;
+    char argument[sizeof (OscArgument64)];
+    bool isValid;
+    switch (typeTag) {
+        case OscTypeTagInt32:
+        {
+            int64_t int64;
+            isValid = OscTextParseInt64(number, numberLength, INT32_MIN, INT32_MAX, &int64);
+            jsonReader->jsonIndex += numberLength;
+            OscFormatWriteInt32(argument, (int32_t) int64);
+            OscFormatWriterWrite(writer, argument, sizeof (OscArgument32));
+            break;
+        }
+        case OscTypeTagFloat32:
+        {
+            double value;
+            OscArgument32 oscArgument32;
+            if (ParseNonFinite(jsonReader, &value) == true) {
+                isValid = true;
+                oscArgument32.float32 = (float) value;
+            } else {
+                isValid = OscTextParseFloat32(number, numberLength, &oscArgument32.float32);
+                jsonReader->jsonIndex += numberLength;
+            }
+            OscFormatWriteInt32(argument, oscArgument32.int32);
+            OscFormatWriterWrite(writer, argument, sizeof (OscArgument32));
+            break;
+        }
+        case OscTypeTagString:
+        case OscTypeTagAlternateString:
+        {
+            const size_t stringStart = writer->size;
+            isValid = ParseString(jsonReader, writer);
+            if ((writer->isFull == false) && (memchr(&writer->destination[stringStart], '\0', writer->size - stringStart) != NULL)) {
+                isValid = false; // string cannot contain null character
+            }
+            OscFormatWriterWrite(writer, "", 1);
+            OscFormatWriterWritePadding(writer);
+            break;
+        }
+        case OscTypeTagBlob:
+        {
+            const size_t blobSizeIndex = writer->size;
+            OscFormatWriterWrite(writer, "\0\0\0\0", sizeof (OscArgument32)); // written below
+            size_t numberOfBytes;
+            isValid = ParseBase64(jsonReader, writer, &numberOfBytes);
+            if (writer->isFull == false) {
+                OscFormatWriteInt32(&writer->destination[blobSizeIndex], (int32_t) numberOfBytes);
+            }
+            OscFormatWriterWritePadding(writer);
+            break;
+        }
+        case OscTypeTagInt64:
+        {
+            int64_t int64;
+            isValid = OscTextParseInt64(number, numberLength, INT64_MIN, INT64_MAX, &int64);
+            jsonReader->jsonIndex += numberLength;
+            OscFormatWriteInt32(argument, (int32_t) ((uint64_t) int64 >> 32));
+            OscFormatWriteInt32(&argument[sizeof (OscArgument32)], (int32_t) int64);
+            OscFormatWriterWrite(writer, argument, sizeof (OscArgument64));
+            break;
+        }
+        case OscTypeTagTimeTag:
+        {
+            const char * text;
+            size_t textLength;
+            OscTimeTag oscTimeTag;
+            oscTimeTag.value = 0;
+            isValid = (ParseRawString(jsonReader, &text, &textLength) == true) && (OscTextParseTimeTag(text, textLength, &oscTimeTag) == true);
+            OscFormatWriteInt32(argument, (int32_t) (oscTimeTag.value >> 32));
+            OscFormatWriteInt32(&argument[sizeof (OscArgument32)], (int32_t) oscTimeTag.value);
+            OscFormatWriterWrite(writer, argument, sizeof (OscArgument64));
+            break;
+        }
+        case OscTypeTagDouble:
+        {
+            double double64;
+            if (ParseNonFinite(jsonReader, &double64) == true) {
+                isValid = true;
+            } else {
+                isValid = OscTextParseDouble(number, numberLength, &double64);
+                jsonReader->jsonIndex += numberLength;
+            }
+            OscArgument64 oscArgument64;
+            oscArgument64.double64 = (Double64) double64;
+            OscFormatWriteInt32(argument, (int32_t) (oscArgument64.int64 >> 32));
+            OscFormatWriteInt32(&argument[sizeof (OscArgument32)], (int32_t) oscArgument64.int64);
+            OscFormatWriterWrite(writer, argument, sizeof (OscArgument64));
+            break;
+        }
+        case OscTypeTagCharacter:
+        {
+            OscFormatWriterWrite(writer, "\0\0\0", 3);
+            const size_t characterStart = writer->size;
+            isValid = ParseString(jsonReader, writer);
+            if ((writer->isFull == false) && ((writer->size - characterStart) != 1)) {
+                isValid = false; // must be single character
+            }
+            break;
+        }
+        case OscTypeTagRgbaColour:
+        case OscTypeTagMidiMessage:
+        {
+            int64_t int64;
+            isValid = OscTextParseInt64(number, numberLength, 0, UINT32_MAX, &int64);
+            jsonReader->jsonIndex += numberLength;
+            OscFormatWriteInt32(argument, (int32_t) (uint32_t) int64);
+            OscFormatWriterWrite(writer, argument, sizeof (OscArgument32));
+            break;
+        }
+        case OscTypeTagTrue:
+            isValid = ParseLiteral(jsonReader, "true");
+            break;
+        case OscTypeTagFalse:
+            isValid = ParseLiteral(jsonReader, "false");
+            break;
+        case OscTypeTagNil:
+        case OscTypeTagInfinitum:
+            isValid = ParseLiteral(jsonReader, "null");
+            break;
+        default:
+            return OscErrorUnknownTypeTag; // error: type tag string contains unknown type tag
+    }
+    if (isValid == false) {
+        return OscErrorInvalidJsonValue; // error: value invalid for type tag
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Returns the type tag of the JSON value at the JSON index.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @return Type tag, or null character if the JSON value is not supported.
+ */
+static char InferTypeTag(const JsonReader * const jsonReader) {
+    if (jsonReader->jsonIndex >= jsonReader->jsonSize) {
+        return '\0';
+    }
+    const char * const json = &jsonReader->json[jsonReader->jsonIndex];
+    switch (json[0]) {
+        case '"':
+            return OscTypeTagString;
+        case '[':
+            return OscTypeTagBeginArray;
+        case 't':
+            return OscTypeTagTrue;
+        case 'f':
+            return OscTypeTagFalse;
+        case 'n':
+            return OscTypeTagNil;
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+        {
+            const size_t numberLength = GetNumberEnd(jsonReader) - jsonReader->jsonIndex;
+            int64_t int64;
+            if (OscTextParseInt64(json, numberLength, INT32_MIN, INT32_MAX, &int64) == true) {
+                return OscTypeTagInt32;
+            }
+            if (OscTextParseInt64(json, numberLength, INT64_MIN, INT64_MAX, &int64) == true) {
+                return OscTypeTagInt64;
+            }
+            return OscTypeTagFloat32;
+        }
+        default:
+            return '\0';
+    }
+}
+
+/**
+ * @brief Advances the JSON reader past any whitespace.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ */
+static void SkipWhitespace(JsonReader * const jsonReader) {
+    while (jsonReader->jsonIndex < jsonReader->jsonSize) {
+        const char character = jsonReader->json[jsonReader->jsonIndex];
+        if ((character != ' ') && (character != '\t') && (character != '\r') && (character != '\n')) {
+            return;
+        }
+        jsonReader->jsonIndex++;
+    }
+}
+
+/**
+ * @brief Parses a structural character preceded by optional whitespace.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @param character Character.
+ * @return True if the character was parsed.
+ */
+static bool ParseCharacter(JsonReader * const jsonReader, const char character) {
+    SkipWhitespace(jsonReader);
+    if ((jsonReader->jsonIndex >= jsonReader->jsonSize) || (jsonReader->json[jsonReader->jsonIndex] != character)) {
+        return false;
+    }
+    jsonReader->jsonIndex++;
+    return true;
+}
+
+/**
+ * @brief Parses a JSON literal such as true, false, or null.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @param literal Literal.
+ * @return True if the literal was parsed.
+ */
+static bool ParseLiteral(JsonReader * const jsonReader, const char * const literal) {
+    const size_t literalLength = strlen(literal);
+    if (((jsonReader->jsonIndex + literalLength) > jsonReader->jsonSize) || (memcmp(&jsonReader->json[jsonReader->jsonIndex], literal, literalLength) != 0)) {
+        return false;
+    }
+    jsonReader->jsonIndex += literalLength;
+    return true;
+}
+
+/**
+ * @brief Parses a JSON string that does not contain escaped characters.  The
+ * string is not copied.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @param string Address of the first character of the string.
+ * @param stringLength Length of the string.
+ * @return True if successful.
+ */
+static bool ParseRawString(JsonReader * const jsonReader, const char * * const string, size_t * const stringLength) {
+    *string = NULL;
+    *stringLength = 0;
+    if ((jsonReader->jsonIndex >= jsonReader->jsonSize) || (jsonReader->json[jsonReader->jsonIndex] != '"')) {
+        return false;
+    }
+    const char * const start = &jsonReader->json[jsonReader->jsonIndex + 1];
+    const char * const end = memchr(start, '"', jsonReader->jsonSize - (jsonReader->jsonIndex + 1));
+    if ((end == NULL) || (memchr(start, '\\', end - start) != NULL)) {
+        return false; // no closing quote or contains escaped characters
+    }
+    *string = start;
+    *stringLength = end - start;
+    jsonReader->jsonIndex += *stringLength + 2;
+    return true;
+}
+
+/**
+ * @brief Parses a JSON string and writes the unescaped characters.  Unicode
+ * escape sequences are written as UTF-8, except for \u0080 to \u00FF which are
+ * written as single bytes as written by WriteString.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @param writer OscFormatWriter structure.
+ * @return True if successful.
+ */
+static bool ParseString(JsonReader * const jsonReader, OscFormatWriter * const writer) {
+    const char * const json = jsonReader->json;
+    size_t jsonIndex = jsonReader->jsonIndex;
+    if ((jsonIndex >= jsonReader->jsonSize) || (json[jsonIndex] != '"')) {
+        return false;
+    }
+    jsonIndex++;
+    size_t runStart = jsonIndex; // start of characters that are not escaped
+    while (true) {
+        if (jsonIndex >= jsonReader->jsonSize) {
+            return false; // no closing quote
+        }
+        const unsigned char character = (unsigned char) json[jsonIndex];
+        if (character == '"') {
+            break;
+        }
+        if (character < ' ') {
+            return false; // control characters must be escaped
+        }
+        if (character != '\\') {
+            jsonIndex++;
+            continue;
+        }
+        OscFormatWriterWrite(writer, &json[runStart], jsonIndex - runStart);
+        jsonIndex++;
+        if (jsonIndex >= jsonReader->jsonSize) {
+            return false;
+        }
+        char escaped = json[jsonIndex++];
+        switch (escaped) {
+            case '"':
+            case '\\':
+            case '/':
+                break;
+            case 'b':
+                escaped = '\b';
+                break;
+            case 'f':
+                escaped = '\f';
+                break;
+            case 'n':
+                escaped = '\n';
+                break;
+            case 'r':
+                escaped = '\r';
+                break;
+            case 't':
+                escaped = '\t';
+                break;
+            case 'u':
+            {
+                uint32_t codePoint = 0;
+                unsigned int numberOfCodeUnits = 1;
+                unsigned int codeUnitIndex;
+                for (codeUnitIndex = 0; codeUnitIndex < numberOfCodeUnits; codeUnitIndex++) {
+                    if (codeUnitIndex == 1) {
+                        if (((jsonIndex + 2) > jsonReader->jsonSize) || (json[jsonIndex] != '\\') || (json[jsonIndex + 1] != 'u')) {
+                            return false; // high surrogate must be followed by low surrogate
+                        }
+                        jsonIndex += 2;
+                    }
+                    if ((jsonIndex + 4) > jsonReader->jsonSize) {
+                        return false;
+                    }
+                    uint32_t codeUnit = 0;
+                    unsigned int digitIndex;
+                    for (digitIndex = 0; digitIndex < 4; digitIndex++) {
+                        const unsigned int digit = OscFormatGetHexadecimalValue(json[jsonIndex++]);
+                        if (digit > 0xF) {
+                            return false;
+                        }
+                        codeUnit = (codeUnit << 4) | digit;
+                    }
+                    if (codeUnitIndex == 0) {
+                        if ((codeUnit >= 0xD800) && (codeUnit <= 0xDBFF)) {
+                            numberOfCodeUnits = 2;
+                        } else if ((codeUnit >= 0xDC00) && (codeUnit <= 0xDFFF)) {
+                            return false; // unpaired low surrogate
+                        }
+                        codePoint = codeUnit;
+                    } else {
+                        if ((codeUnit < 0xDC00) || (codeUnit > 0xDFFF)) {
+                            return false; // high surrogate must be followed by low surrogate
+                        }
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (codeUnit - 0xDC00);
+                    }
+                }
+                char utf8[4];
+                size_t utf8Length;
+                if (codePoint < 0x100) {
+                    utf8[0] = (char) codePoint; // 0x80 to 0xFF written as byte
+                    utf8Length = 1;
+                } else if (codePoint < 0x800) {
+                    utf8[0] = (char) (0xC0 | (codePoint >> 6));
+                    utf8[1] = (char) (0x80 | (codePoint & 0x3F));
+                    utf8Length = 2;
+                } else if (codePoint < 0x10000) {
+                    utf8[0] = (char) (0xE0 | (codePoint >> 12));
+                    utf8[1] = (char) (0x80 | ((codePoint >> 6) & 0x3F));
+                    utf8[2] = (char) (0x80 | (codePoint & 0x3F));
+                    utf8Length = 3;
+                } else {
+                    utf8[0] = (char) (0xF0 | (codePoint >> 18));
+                    utf8[1] = (char) (0x80 | ((codePoint >> 12) & 0x3F));
+                    utf8[2] = (char) (0x80 | ((codePoint >> 6) & 0x3F));
+                    utf8[3] = (char) (0x80 | (codePoint & 0x3F));
+                    utf8Length = 4;
+                }
+                OscFormatWriterWrite(writer, utf8, utf8Length);
+                runStart = jsonIndex;
+                continue;
+            }
+            default:
+                return false; // unknown escape sequence
+        }
+        OscFormatWriterWrite(writer, &escaped, 1);
+        runStart = jsonIndex;
+    }
+    OscFormatWriterWrite(writer, &json[runStart], jsonIndex - runStart);
+    jsonReader->jsonIndex = jsonIndex + 1; // skip closing quote
+    return true;
+}
+
+/**
+ * @brief Parses a base64 JSON string and writes the decoded bytes.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @param writer OscFormatWriter structure.
+ * @param numberOfBytes Number of bytes.
+ * @return True if successful.
+ */
+static bool ParseBase64(JsonReader * const jsonReader, OscFormatWriter * const writer, size_t * const numberOfBytes) {
+    *numberOfBytes = 0;
+    const char * text;
+    size_t textLength;
+    if ((ParseRawString(jsonReader, &text, &textLength) == false) || ((textLength % 4) != 0)) {
+        return false;
+    }
+    size_t textIndex;
+    for (textIndex = 0; textIndex < textLength; textIndex += 4) {
+        const bool isLastGroup = (textIndex + 4) == textLength;
+        unsigned int numberOfPadding = 0;
+        if ((isLastGroup == true) && (text[textIndex + 3] == '=')) {
+            numberOfPadding = (text[textIndex + 2] == '=') ? 2 : 1;
+        }
+        uint32_t group = 0;
+        unsigned int characterIndex;
+        for (characterIndex = 0; characterIndex < (4 - numberOfPadding); characterIndex++) {
+            const unsigned int value = GetBase64Value(text[textIndex + characterIndex]);
+            if (value > 0x3F) {
+                return false;
+            }
+            group |= (uint32_t) value << (18 - (6 * characterIndex));
+        }
+        const char bytes[3] = {(char) (group >> 16), (char) (group >> 8), (char) group};
+        OscFormatWriterWrite(writer, bytes, 3 - numberOfPadding);
+        *numberOfBytes += 3 - numberOfPadding;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses the JSON string "NaN", "Infinity", or "-Infinity".
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @param value Value.
+ * @return True if successful.
+ */
+static bool ParseNonFinite(JsonReader * const jsonReader, double * const value) {
+    if (ParseLiteral(jsonReader, "\"NaN\"") == true) {
+        *value = NAN;
+        return true;
+    }
+    if (ParseLiteral(jsonReader, "\"Infinity\"") == true) {
+        *value = INFINITY;
+        return true;
+    }
+    if (ParseLiteral(jsonReader, "\"-Infinity\"") == true) {
+        *value = -INFINITY;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Returns the index of the end of the JSON number at the JSON index.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @return Index of the first character that cannot be part of a number.
+ */
+static size_t GetNumberEnd(const JsonReader * const jsonReader) {
+    size_t jsonIndex = jsonReader->jsonIndex;
+    while (jsonIndex < jsonReader->jsonSize) {
+        const char character = jsonReader->json[jsonIndex];
+        if (((character < '0') || (character > '9')) && (character != '-') && (character != '+') && (character != '.') && (character != 'e') && (character != 'E')) {
+            break;
+        }
+        jsonIndex++;
+    }
+    return jsonIndex;
+}
+
+/**
+ * @brief Advances the JSON reader past a JSON value of any type.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param jsonReader JSON reader structure.
+ * @return True if successful.
+ */
+static bool SkipValue(JsonReader * const jsonReader) {
+    const char * const json = jsonReader->json;
+    unsigned int depth = 0;
+    while (jsonReader->jsonIndex < jsonReader->jsonSize) {
+        const char character = json[jsonReader->jsonIndex];
+        if (character == '"') {
+            jsonReader->jsonIndex++;
+            while ((jsonReader->jsonIndex < jsonReader->jsonSize) && (json[jsonReader->jsonIndex] != '"')) {
+                jsonReader->jsonIndex += (json[jsonReader->jsonIndex] == '\\') ? 2 : 1;
+            }
+            if (jsonReader->jsonIndex >= jsonReader->jsonSize) {
+                return false; // no closing quote
+            }
+            jsonReader->jsonIndex++;
+            if (depth == 0) {
+                return true;
+            }
+            continue;
+        }
+        if ((character == '{') || (character == '[')) {
+            depth++;
+        } else if ((character == '}') || (character == ']')) {
+            if (depth == 0) {
+                return true; // end of enclosing object
+            }
+            depth--;
+            if (depth == 0) {
+                jsonReader->jsonIndex++;
+                return true;
+            }
+        } else if ((character == ',') && (depth == 0)) {
+            return true;
+        }
+        jsonReader->jsonIndex++;
+    }
+    return false;
+}
+
+/**
+ * @brief Returns true if a JSON member name is equal to a name.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param key Member name.
+ * @param keyLength Length of the member name.
+ * @param name Name.
+ * @return True if the member name is equal to the name.
+ */
+static bool IsKey(const char * const key, const size_t keyLength, const char * const name) {
+    return (keyLength == strlen(name)) && (memcmp(key, name, keyLength) == 0);
+}
+
+/**
+ * @brief Returns the value of a base64 character.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param character Character.
+ * @return Value of the base64 character, or a value greater than 0x3F if the
+ * character is not a base64 character.
+ */
+static unsigned int GetBase64Value(const char character) {
+    if ((character >= 'A') && (character <= 'Z')) {
+        return character - 'A';
+    }
+    if ((character >= 'a') && (character <= 'z')) {
+        return character - 'a' + 26;
+    }
+    if ((character >= '0') && (character <= '9')) {
+        return character - '0' + 52;
+    }
+    if (character == '+') {
+        return 62;
+    }
+    if (character == '/') {
+        return 63;
+    }
+    return 0x40;
+}
+
+//------------------------------------------------------------------------------
+// End of file
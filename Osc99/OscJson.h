@@ -0,0 +1,33 @@
+/**
+ * @file OscJson.h
+ * @author Seb Madgwick
+ * @brief Functions for converting between OSC packets and JSON.  Each OSC
+ * message is represented by a JSON object containing the OSC address pattern,
+ * the OSC type tag string, and an array of the arguments, for example:
+ * {"a":"/example","t":",ifs","v":[1,2.5,"text"]}
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_JSON_H
+#define OSC_JSON_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscPacket.h"
+#include <stddef.h>
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+OscError OscJsonFormatPacket(const OscPacket * const oscPacket, size_t * const jsonSize, char * const destination, const size_t destinationSize);
+OscError OscJsonFormatContents(const void * const oscContents, const size_t contentsSize, size_t * const jsonSize, char * const destination, const size_t destinationSize);
+OscError OscJsonParsePacket(const char * const json, const size_t jsonSize, size_t * const jsonParsed, OscPacket * const oscPacket);
+OscError OscJsonParseContents(const char * const json, const size_t jsonSize, size_t * const jsonParsed, size_t * const contentsSize, char * const destination, const size_t destinationSize);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
@@ -0,0 +1,224 @@
+/**
+ * @file OscLog.c
+ * @author Seb Madgwick
+ * @brief Functions and structures for logging OSC packets with deferred
+ * processing.  Each record is copied to a lock-free ring buffer so that the
+ * cost to the producer is only that of the copy.  Records are processed later
+ * by a single consumer such as a background thread.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscLog.h"
+#include <stdint.h> // SIZE_MAX
+#include <string.h> // memcpy
+#ifdef _MSC_VER
+#include <windows.h> // MemoryBarrier
+#endif
+
+//------------------------------------------------------------------------------
+// Definitions
+
+#ifndef OSC_MEMORY_BARRIER
+#error "OSC_MEMORY_BARRIER must be defined in OscCommon.h for this compiler"
+#endif
+
+/**
+ * @brief Record size indicating that the next record is at the start of the
+ * buffer.
+ */
+#define WRAP_RECORD_SIZE (SIZE_MAX)
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Initialises an OSC log structure.
+ *
+ * An OSC log structure must be initialised before use.  An OSC log has a
+ * single producer and a single consumer, which may be different threads or an
+ * interrupt and the main loop.  Records are written by the producer without
+ * locks and so an application with several producer threads should use a
+ * separate OSC log for each thread.  The processRecord function must be
+ * implemented by the user application and is called by OscLogDrain for each
+ * record.
+ *
+ * Example use:
+ * @code
+ * void ProcessRecord(void* param, const OscTimeTag * const timestamp, const char * const contents, const size_t contentsSize) {
+ *     char text[4096];
+ *     size_t textSize;
+ *     if (OscTextFormatContents(contents, contentsSize, &textSize, text, sizeof(text)) == OscErrorNone) {
+ *         fwrite(text, 1, textSize, (FILE *) param);
+ *     }
+ * }
+ *
+ * OscLog oscLog;
+ * OscLogInitialise(&oscLog);
+ * oscLog.processRecord = ProcessRecord;
+ * oscLog.param = myLogFile;
+ * @endcode
+ *
+ * @param oscLog OSC log structure to be initialised.
+ */
+void OscLogInitialise(OscLog * const oscLog) {
+    oscLog->writeIndex = 0;
+    oscLog->readIndex = 0;
+    oscLog->numberOfDroppedRecords = 0;
+    oscLog->processRecord = NULL;
+    oscLog->param = NULL;
+}
+
+/**
+ * @brief Writes a record to the OSC log.  This function must only be called
+ * by the producer.
+ *
+ * The contents are copied to the ring buffer with the timestamp and the
+ * function returns without processing the record.  If there is insufficient
+ * space in the ring buffer then the record is dropped and the number of
+ * dropped records is incremented.  The timestamp is not interpreted and may be
+ * any 64-bit value provided by the user application.
+ *
+ * Example use:
+ * @code
+ * OscLogWrite(&oscLog, MyGetTime(), source, numberOfBytes);
+ * @endcode
+ *
+ * @param oscLog OSC log structure.
+ * @param timestamp Timestamp of the record.
+ * @param contents Contents of the record.
+ * @param contentsSize Size of the contents.
+ * @return Error code (0 if successful).
+ */
+OscError OscLogWrite(OscLog * const oscLog, const OscTimeTag timestamp, const void * const contents, const size_t contentsSize) {
+    const size_t recordSize = sizeof (OscLogRecordHeader) + contentsSize;
+    if ((contentsSize >= OSC_LOG_BUFFER_SIZE) || (recordSize >= OSC_LOG_BUFFER_SIZE)) {
+        oscLog->numberOfDroppedRecords++;
+        return OscErrorLogRecordTooLarge; // error: record too large for buffer
+    }
+
+    // Check space available
+    const size_t readIndex = oscLog->readIndex;
+    OSC_MEMORY_BARRIER(); // consumer must have finished with space before it is overwritten
+    size_t writeIndex = oscLog->writeIndex;
+    const size_t spaceAvailable = (readIndex > writeIndex) ? (readIndex - writeIndex - 1) : ((OSC_LOG_BUFFER_SIZE - writeIndex) + readIndex - 1);
+    const size_t spaceToEnd = OSC_LOG_BUFFER_SIZE - writeIndex;
+    const size_t spaceSkipped = (spaceToEnd < recordSize) ? spaceToEnd : 0; // record must be contiguous
+    if ((spaceSkipped + recordSize) > spaceAvailable) {
+        oscLog->numberOfDroppedRecords++;
+        return OscErrorLogFull; // error: insufficient space
+    }
+
+    // Write record
+    OscLogRecordHeader recordHeader;
+    if (spaceSkipped > 0) {
+        if (spaceSkipped >= sizeof (OscLogRecordHeader)) {
+            recordHeader.size = WRAP_RECORD_SIZE;
+            memcpy(&oscLog->buffer[writeIndex], &recordHeader, sizeof (OscLogRecordHeader));
+        }
+        writeIndex = 0;
+    }
+    recordHeader.timestamp = timestamp;
+    recordHeader.size = contentsSize;
+    memcpy(&oscLog->buffer[writeIndex], &recordHeader, sizeof (OscLogRecordHeader));
+    memcpy(&oscLog->buffer[writeIndex + sizeof (OscLogRecordHeader)], contents, contentsSize);
+    writeIndex += recordSize;
+    if (writeIndex == OSC_LOG_BUFFER_SIZE) {
+        writeIndex = 0;
+    }
+    OSC_MEMORY_BARRIER(); // record must be complete before it is visible to consumer
+    oscLog->writeIndex = writeIndex;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Writes an OSC packet to the OSC log.  This function must only be
+ * called by the producer.
+ *
+ * Example use:
+ * @code
+ * void ProcessPacket(OscPacket * const oscPacket) {
+ *     OscLogWritePacket(&oscLog, MyGetTime(), oscPacket);
+ *     OscPacketProcessMessages(oscPacket);
+ * }
+ * @endcode
+ *
+ * @param oscLog OSC log structure.
+ * @param timestamp Timestamp of the record.
+ * @param oscPacket OSC packet to be written.
+ * @return Error code (0 if successful).
+ */
+OscError OscLogWritePacket(OscLog * const oscLog, const OscTimeTag timestamp, const OscPacket * const oscPacket) {
+    return OscLogWrite(oscLog, timestamp, oscPacket->contents, oscPacket->size);
+}
+
+/**
+ * @brief Processes all records written to the OSC log.  This function must
+ * only be called by the consumer.
+ *
+ * The processRecord function is called for each record in the order that the
+ * records were written.  The contents provided to the processRecord function
+ * remain valid only until the function returns.  Space is released to the
+ * producer after each record is processed.  Records written while this
+ * function is running are processed by the next call.
+ *
+ * Example use:
+ * @code
+ * while (true) {
+ *     OscLogDrain(&oscLog);
+ *     MySleep(10);
+ * }
+ * @endcode
+ *
+ * @param oscLog OSC log structure.
+ * @return Error code (0 if successful).
+ */
+OscError OscLogDrain(OscLog * const oscLog) {
+    if (oscLog->processRecord == NULL) {
+        return OscErrorCallbackFunctionUndefined; // error: user function undefined
+    }
+    const size_t writeIndex = oscLog->writeIndex;
+    OSC_MEMORY_BARRIER(); // records must not be read before write index
+    size_t readIndex = oscLog->readIndex;
+    while (readIndex != writeIndex) {
+        if ((OSC_LOG_BUFFER_SIZE - readIndex) < sizeof (OscLogRecordHeader)) {
+            readIndex = 0; // record skipped to start of buffer
+            continue;
+        }
+        OscLogRecordHeader recordHeader;
+        memcpy(&recordHeader, &oscLog->buffer[readIndex], sizeof (OscLogRecordHeader));
+        if (recordHeader.size == WRAP_RECORD_SIZE) {
+            readIndex = 0; // record skipped to start of buffer
+            continue;
+        }
+        oscLog->processRecord(oscLog->param, &recordHeader.timestamp, &oscLog->buffer[readIndex + sizeof (OscLogRecordHeader)], recordHeader.size);
+        readIndex += sizeof (OscLogRecordHeader) + recordHeader.size;
+        if (readIndex == OSC_LOG_BUFFER_SIZE) {
+            readIndex = 0;
+        }
+        OSC_MEMORY_BARRIER(); // record must be processed before space is released
+        oscLog->readIndex = readIndex;
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Returns the number of records dropped because there was insufficient
+ * space in the OSC log.
+ *
+ * Example use:
+ * @code
+ * printf("%u records dropped", OscLogGetNumberOfDroppedRecords(&oscLog));
+ * @endcode
+ *
+ * @param oscLog OSC log structure.
+ * @return Number of dropped records.
+ */
+unsigned int OscLogGetNumberOfDroppedRecords(const OscLog * const oscLog) {
+    return oscLog->numberOfDroppedRecords;
+}
+
+//------------------------------------------------------------------------------
+// End of file
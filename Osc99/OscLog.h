@@ -0,0 +1,68 @@
+/**
+ * @file OscLog.h
+ * @author Seb Madgwick
+ * @brief Functions and structures for logging OSC packets with deferred
+ * processing.  Each record is copied to a lock-free ring buffer so that the
+ * cost to the producer is only that of the copy.  Records are processed later
+ * by a single consumer such as a background thread.
+ *
+ * OSC_LOG_BUFFER_SIZE may be modified as required by the user application.
+ *
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_LOG_H
+#define OSC_LOG_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscPacket.h"
+#include <stddef.h>
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Size of the ring buffer of an OSC log.  This value may be modified
+ * as required by the user application.
+ */
+#define OSC_LOG_BUFFER_SIZE (8 * MAX_TRANSPORT_SIZE)
+
+/**
+ * @brief OSC log record header structure.  This structure is used internally
+ * and should not be used by the user application.
+ */
+typedef struct {
+    OscTimeTag timestamp;
+    size_t size;
+} OscLogRecordHeader;
+
+/**
+ * @brief OSC log structure.  Structure members are used internally and should
+ * not be used by the user application.
+ */
+typedef struct {
+    char buffer[OSC_LOG_BUFFER_SIZE];
+    volatile size_t writeIndex; // modified by producer only
+    volatile size_t readIndex; // modified by consumer only
+    volatile unsigned int numberOfDroppedRecords; // modified by producer only
+    void ( *processRecord)(void* param, const OscTimeTag * const timestamp, const char * const contents, const size_t contentsSize);
+    void* param;
+} OscLog;
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+void OscLogInitialise(OscLog * const oscLog);
+OscError OscLogWrite(OscLog * const oscLog, const OscTimeTag timestamp, const void * const contents, const size_t contentsSize);
+OscError OscLogWritePacket(OscLog * const oscLog, const OscTimeTag timestamp, const OscPacket * const oscPacket);
+OscError OscLogDrain(OscLog * const oscLog);
+unsigned int OscLogGetNumberOfDroppedRecords(const OscLog * const oscLog);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
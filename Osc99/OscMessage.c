@@ -10,8 +10,9 @@
 // Includes
 
 #include <limits.h> // SCHAR_MAX
+#include "OscHash.h"
 #include "OscMessage.h"
-#include <string.h> // strlen
+#include <string.h> // strcmp, strcpy, strlen
 #include <math.h>
 
 #ifdef _WIN32
@@ -19,11 +20,65 @@
 #pragma warning (disable: 4018)
 #endif
 
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Type tag class flag indicating that the character is a valid OSC type
+ * tag.
+ */
+#define TYPE_TAG_VALID (0x80)
+
+/**
+ * @brief Type tag class flag indicating that the size of the argument is
+ * variable.  The size within the type tag class is then the minimum size.
+ */
+#define TYPE_TAG_VARIABLE_SIZE (0x40)
+
+/**
+ * @brief Mask of the argument size (number of bytes) within a type tag class.
+ */
+#define TYPE_TAG_SIZE_MASK (0x0F)
+
+/**
+ * @brief Value of an unused OSC signature registry index entry.
+ */
+#define NO_INDEX ((unsigned int) -1)
+
+/**
+ * @brief Type tag class of each ASCII character.  Each type tag may then be
+ * classified with a single lookup rather than a switch statement.
+ */
+static const unsigned char typeTagClasses[128] = {
+    [OscTypeTagInt32] = TYPE_TAG_VALID | 4,
+    [OscTypeTagFloat32] = TYPE_TAG_VALID | 4,
+    [OscTypeTagString] = TYPE_TAG_VALID | TYPE_TAG_VARIABLE_SIZE | 4,
+    [OscTypeTagBlob] = TYPE_TAG_VALID | TYPE_TAG_VARIABLE_SIZE | 4,
+    [OscTypeTagInt64] = TYPE_TAG_VALID | 8,
+    [OscTypeTagTimeTag] = TYPE_TAG_VALID | 8,
+    [OscTypeTagDouble] = TYPE_TAG_VALID | 8,
+    [OscTypeTagAlternateString] = TYPE_TAG_VALID | TYPE_TAG_VARIABLE_SIZE | 4,
+    [OscTypeTagCharacter] = TYPE_TAG_VALID | 4,
+    [OscTypeTagRgbaColour] = TYPE_TAG_VALID | 4,
+    [OscTypeTagMidiMessage] = TYPE_TAG_VALID | 4,
+    [OscTypeTagTrue] = TYPE_TAG_VALID,
+    [OscTypeTagFalse] = TYPE_TAG_VALID,
+    [OscTypeTagNil] = TYPE_TAG_VALID,
+    [OscTypeTagInfinitum] = TYPE_TAG_VALID,
+    [OscTypeTagBeginArray] = TYPE_TAG_VALID,
+    [OscTypeTagEndArray] = TYPE_TAG_VALID,
+};
 
 //------------------------------------------------------------------------------
 // Function prototypes
 
 static int TerminateOscString(char * const oscString, size_t * const oscStringSize, const size_t maxOscStringSize);
+static OscError ParseCharArray(OscMessage * const oscMessage, const char * const source, const size_t numberOfBytes);
+static OscError ParseAddressPatternAndTypeTagString(OscMessage * const oscMessage, const char * const source, const size_t numberOfBytes, size_t * const argumentsIndex);
+static OscError ValidateArgumentsSize(const OscMessage * const oscMessage);
+static unsigned int FindSignatureIndexEntry(const OscSignatureRegistry * const oscSignatureRegistry, const char * const oscTypeTagString);
+static size_t GetNumericArrayElementSize(const OscTypeTag elementType);
+static size_t GetRunLength(const OscMessage * const oscMessage, const size_t argumentSize, const size_t maximumRunLength);
 
 //------------------------------------------------------------------------------
 // Functions - Message construction
@@ -254,6 +309,122 @@ OscError OscMessageAddBlob(OscMessage * const oscMessage, const char * const sou
     return OscErrorNone;
 }
 
+/**
+ * @brief Adds a numeric array as a blob argument to an OSC message.
+ *
+ * This function allows a large array of numbers to be sent as a single
+ * argument rather than as one argument per element.  The blob contains a
+ * header of OSC_NUMERIC_ARRAY_HEADER_SIZE bytes indicating the element type
+ * and number of elements, followed by the big-endian elements.  The source
+ * must be an array of int32_t, float, int64_t, or Double64 for an element type
+ * of OscTypeTagInt32, OscTypeTagFloat32, OscTypeTagInt64, or OscTypeTagDouble
+ * respectively.  The receiver must use OscMessageGetNumericArray to interpret
+ * the blob.  The array must fit within MAX_ARGUMENTS_SIZE with the blob size
+ * and header, so the default MAX_ARGUMENTS_SIZE of 1383 bytes limits an array
+ * to 342 32-bit elements or 171 64-bit elements.
+ *
+ * Example use:
+ * @code
+ * float meters[256];
+ * OscMessageAddNumericArray(&oscMessage, OscTypeTagFloat32, meters, 256);
+ * @endcode
+ *
+ * @param oscMessage OSC message.
+ * @param elementType OSC type tag of the elements.
+ * @param source Array of elements to be added as argument.
+ * @param numberOfElements Number of elements in array.
+ * @return Error code (0 if successful).
+ */
+OscError OscMessageAddNumericArray(OscMessage * const oscMessage, const OscTypeTag elementType, const void * const source, const size_t numberOfElements) {
+    if (oscMessage->oscTypeTagStringLength > MAX_NUMBER_OF_ARGUMENTS) {
+        return OscErrorTooManyArguments; // error: too many arguments
+    }
+    const size_t elementSize = GetNumericArrayElementSize(elementType);
+    if (elementSize == 0) {
+        return OscErrorUnsupportedNumericArrayType; // error: unsupported element type
+    }
+    if (numberOfElements > ((MAX_ARGUMENTS_SIZE - sizeof (OscArgument32) - OSC_NUMERIC_ARRAY_HEADER_SIZE) / elementSize)) {
+        return OscErrorArgumentsSizeTooLarge; // error: message full
+    }
+    const size_t blobSize = OSC_NUMERIC_ARRAY_HEADER_SIZE + (numberOfElements * elementSize);
+    if ((oscMessage->argumentsSize + sizeof (OscArgument32) + blobSize) > MAX_ARGUMENTS_SIZE) {
+        return OscErrorArgumentsSizeTooLarge; // error: message full
+    }
+    char * destination = &oscMessage->arguments[oscMessage->argumentsSize];
+
+    // Blob size and header
+    OscArgument32 oscArgument32;
+    oscArgument32.int32 = (int32_t) blobSize;
+    *destination++ = oscArgument32.byteStruct.byte3;
+    *destination++ = oscArgument32.byteStruct.byte2;
+    *destination++ = oscArgument32.byteStruct.byte1;
+    *destination++ = oscArgument32.byteStruct.byte0;
+    *destination++ = (char) OscTypeTagBeginArray;
+    *destination++ = (char) elementType;
+    *destination++ = '\0';
+    *destination++ = '\0';
+    oscArgument32.int32 = (int32_t) numberOfElements;
+    *destination++ = oscArgument32.byteStruct.byte3;
+    *destination++ = oscArgument32.byteStruct.byte2;
+    *destination++ = oscArgument32.byteStruct.byte1;
+    *destination++ = oscArgument32.byteStruct.byte0;
+
+    // Elements
+    size_t elementIndex;
+    switch (elementType) {
+        case OscTypeTagInt32:
+        case OscTypeTagFloat32:
+        {
+            const OscArgument32 * const elements = (const OscArgument32 *) source;
+            for (elementIndex = 0; elementIndex < numberOfElements; elementIndex++) {
+                *destination++ = elements[elementIndex].byteStruct.byte3;
+                *destination++ = elements[elementIndex].byteStruct.byte2;
+                *destination++ = elements[elementIndex].byteStruct.byte1;
+                *destination++ = elements[elementIndex].byteStruct.byte0;
+            }
+            break;
+        }
+        case OscTypeTagInt64:
+        {
+            const int64_t * const elements = (const int64_t *) source;
+            for (elementIndex = 0; elementIndex < numberOfElements; elementIndex++) {
+                OscArgument64 oscArgument64;
+                oscArgument64.int64 = (uint64_t) elements[elementIndex];
+                *destination++ = oscArgument64.byteStruct.byte7;
+                *destination++ = oscArgument64.byteStruct.byte6;
+                *destination++ = oscArgument64.byteStruct.byte5;
+                *destination++ = oscArgument64.byteStruct.byte4;
+                *destination++ = oscArgument64.byteStruct.byte3;
+                *destination++ = oscArgument64.byteStruct.byte2;
+                *destination++ = oscArgument64.byteStruct.byte1;
+                *destination++ = oscArgument64.byteStruct.byte0;
+            }
+            break;
+        }
+        default: // OscTypeTagDouble
+        {
+            const Double64 * const elements = (const Double64 *) source;
+            for (elementIndex = 0; elementIndex < numberOfElements; elementIndex++) {
+                OscArgument64 oscArgument64;
+                oscArgument64.double64 = elements[elementIndex];
+                *destination++ = oscArgument64.byteStruct.byte7;
+                *destination++ = oscArgument64.byteStruct.byte6;
+                *destination++ = oscArgument64.byteStruct.byte5;
+                *destination++ = oscArgument64.byteStruct.byte4;
+                *destination++ = oscArgument64.byteStruct.byte3;
+                *destination++ = oscArgument64.byteStruct.byte2;
+                *destination++ = oscArgument64.byteStruct.byte1;
+                *destination++ = oscArgument64.byteStruct.byte0;
+            }
+            break;
+        }
+    }
+    oscMessage->argumentsSize += sizeof (OscArgument32) + blobSize; // blob size is always a multiple of four
+    oscMessage->oscTypeTagString[(oscMessage->oscTypeTagStringLength)++] = OscTypeTagBlob;
+    oscMessage->oscTypeTagString[oscMessage->oscTypeTagStringLength] = '\0'; // null terminate string
+    return OscErrorNone;
+}
+
 /**
  * @brief Adds a 64-bit integer argument to an OSC message.
  *
@@ -695,6 +866,239 @@ static int TerminateOscString(char * const oscString, size_t * const oscStringSi
  * @return Error code (0 if successful).
  */
 OscError OscMessageInitialiseFromCharArray(OscMessage * const oscMessage, const char * const source, const size_t numberOfBytes) {
+    const OscError oscError = ParseCharArray(oscMessage, source, numberOfBytes);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    return ValidateArgumentsSize(oscMessage);
+}
+
+/**
+ * @brief Initialises an OSC signature from an OSC type tag string.
+ *
+ * Example use:
+ * @code
+ * OscSignature oscSignature;
+ * OscSignatureInitialise(&oscSignature, ",iif");
+ * @endcode
+ *
+ * @param oscSignature OSC signature to be initialised.
+ * @param oscTypeTagString OSC type tag string, including comma, as a null
+ * terminated string.
+ * @return Error code (0 if successful).
+ */
+OscError OscSignatureInitialise(OscSignature * const oscSignature, const char * const oscTypeTagString) {
+    if (strlen(oscTypeTagString) > MAX_OSC_TYPE_TAG_STRING_LENGTH) {
+        return OscErrorTypeTagStringToLong; // error: type tag string too long
+    }
+    strcpy(oscSignature->oscTypeTagString, oscTypeTagString);
+    oscSignature->oscTypeTagStringLength = strlen(oscTypeTagString);
+    oscSignature->hash = OscHashBytes(oscTypeTagString, oscSignature->oscTypeTagStringLength);
+    oscSignature->isValid = true;
+    oscSignature->isFixedSize = true;
+    oscSignature->argumentsSize = 0;
+    oscSignature->numberOfArguments = 0;
+    oscSignature->numberOfKnownOffsets = 0;
+    unsigned int typeTagIndex;
+    for (typeTagIndex = 1; typeTagIndex < oscSignature->oscTypeTagStringLength; typeTagIndex++) { // skip comma
+        const unsigned char typeTag = (unsigned char) oscTypeTagString[typeTagIndex];
+        const unsigned char typeTagClass = typeTag < sizeof (typeTagClasses) ? typeTagClasses[typeTag] : 0;
+        if ((typeTagClass & TYPE_TAG_VALID) == 0) {
+            oscSignature->isValid = false;
+        }
+        if (oscSignature->isFixedSize == true) {
+            oscSignature->argumentOffsets[oscSignature->numberOfKnownOffsets++] = (unsigned int) oscSignature->argumentsSize;
+        }
+        if ((typeTagClass & TYPE_TAG_VARIABLE_SIZE) != 0) {
+            oscSignature->isFixedSize = false;
+        }
+        oscSignature->argumentSizes[oscSignature->numberOfArguments++] = typeTagClass & TYPE_TAG_SIZE_MASK;
+        oscSignature->argumentsSize += typeTagClass & TYPE_TAG_SIZE_MASK;
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Initialises an OSC signature registry structure.
+ *
+ * An OSC signature registry caches the argument layout of each OSC type tag
+ * string expected by the user application so that OSC messages with a
+ * registered OSC type tag string may be validated without classifying each
+ * type tag.  OSC type tag strings must be added by the user application before
+ * the OSC signature registry is used to receive OSC messages.  An OSC
+ * signature registry may be assigned to an OSC packet so that it is used for
+ * each OSC message within the OSC packet.  The OSC signature registry is only
+ * read when receiving OSC messages and so may be shared between threads.
+ *
+ * Example use:
+ * @code
+ * OscSignatureRegistry oscSignatureRegistry;
+ * OscSignatureRegistryInitialise(&oscSignatureRegistry);
+ * OscSignatureRegistryAdd(&oscSignatureRegistry, ",fff");
+ * OscSignatureRegistryAdd(&oscSignatureRegistry, ",si");
+ * oscPacket.oscSignatureRegistry = &oscSignatureRegistry;
+ * @endcode
+ *
+ * @param oscSignatureRegistry OSC signature registry structure to be
+ * initialised.
+ */
+void OscSignatureRegistryInitialise(OscSignatureRegistry * const oscSignatureRegistry) {
+    oscSignatureRegistry->numberOfSignatures = 0;
+    unsigned int indexEntry;
+    for (indexEntry = 0; indexEntry < OSC_SIGNATURE_INDEX_SIZE; indexEntry++) {
+        oscSignatureRegistry->index[indexEntry] = NO_INDEX;
+    }
+}
+
+/**
+ * @brief Adds an OSC type tag string to an OSC signature registry.  This
+ * function must not be called while the OSC signature registry is being used
+ * to receive OSC messages.
+ *
+ * Example use:
+ * @code
+ * OscSignatureRegistryAdd(&oscSignatureRegistry, ",fff");
+ * @endcode
+ *
+ * @param oscSignatureRegistry OSC signature registry structure.
+ * @param oscTypeTagString OSC type tag string, including comma, as a null
+ * terminated string.
+ * @return Error code (0 if successful).
+ */
+OscError OscSignatureRegistryAdd(OscSignatureRegistry * const oscSignatureRegistry, const char * const oscTypeTagString) {
+    if (strlen(oscTypeTagString) > MAX_OSC_TYPE_TAG_STRING_LENGTH) {
+        return OscErrorTypeTagStringToLong; // error: type tag string too long
+    }
+    const unsigned int indexEntry = FindSignatureIndexEntry(oscSignatureRegistry, oscTypeTagString);
+    if (oscSignatureRegistry->index[indexEntry] != NO_INDEX) {
+        return OscErrorNone; // OSC type tag string already added
+    }
+    if (oscSignatureRegistry->numberOfSignatures >= MAX_OSC_SIGNATURES) {
+        return OscErrorTooManySignatures; // error: registry full
+    }
+    OscSignature * const oscSignature = &oscSignatureRegistry->signatures[oscSignatureRegistry->numberOfSignatures];
+    OscSignatureInitialise(oscSignature, oscTypeTagString);
+    if (oscSignature->isValid == false) {
+        return OscErrorUnknownTypeTag; // error: type tag string contains unknown type tag
+    }
+    oscSignatureRegistry->index[indexEntry] = oscSignatureRegistry->numberOfSignatures++;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Finds the OSC signature of an OSC type tag string.  The OSC signature
+ * registry is not modified.
+ *
+ * Example use:
+ * @code
+ * const OscSignature * oscSignature;
+ * if(OscSignatureRegistryFind(&oscSignatureRegistry, ",fff", &oscSignature) == OscErrorNone) {
+ *     printf("Third argument offset = %u", oscSignature->argumentOffsets[2]);
+ * }
+ * @endcode
+ *
+ * @param oscSignatureRegistry OSC signature registry structure.
+ * @param oscTypeTagString OSC type tag string, including comma, as a null
+ * terminated string.
+ * @param oscSignature Address of the OSC signature.
+ * @return Error code (0 if successful).
+ */
+OscError OscSignatureRegistryFind(const OscSignatureRegistry * const oscSignatureRegistry, const char * const oscTypeTagString, const OscSignature * * const oscSignature) {
+    const unsigned int indexEntry = FindSignatureIndexEntry(oscSignatureRegistry, oscTypeTagString);
+    if (oscSignatureRegistry->index[indexEntry] == NO_INDEX) {
+        return OscErrorSignatureNotFound; // error: type tag string not added
+    }
+    *oscSignature = &oscSignatureRegistry->signatures[oscSignatureRegistry->index[indexEntry]];
+    return OscErrorNone;
+}
+
+/**
+ * @brief Initialises an OSC message from a byte array using an OSC signature
+ * registry.
+ *
+ * This function is equivalent to OscMessageInitialiseFromCharArray except that
+ * the OSC type tag string is validated using the cached OSC signature.  If the
+ * OSC signature is fixed size then the OSC message is validated with a hash
+ * lookup and a single size comparison and the arguments are copied as a
+ * single block of the size known from the OSC signature.  The OSC message is
+ * validated as by OscMessageInitialiseFromCharArray if the OSC type tag string
+ * has not been added to the OSC signature registry.
+ *
+ * This function is used internally and should not be used by the user
+ * application.
+ *
+ * @param oscMessage OSC message.
+ * @param oscSignatureRegistry OSC signature registry.
+ * @param source Byte array.
+ * @param numberOfBytes Number of bytes within the byte array.
+ * @return Error code (0 if successful).
+ */
+OscError OscMessageInitialiseFromCharArrayWithSignatures(OscMessage * const oscMessage, const OscSignatureRegistry * const oscSignatureRegistry, const char * const source, const size_t numberOfBytes) {
+    size_t argumentsIndex;
+    const OscError oscError = ParseAddressPatternAndTypeTagString(oscMessage, source, numberOfBytes, &argumentsIndex);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    const size_t argumentsSize = numberOfBytes - argumentsIndex;
+    const OscSignature * oscSignature;
+    if (OscSignatureRegistryFind(oscSignatureRegistry, oscMessage->oscTypeTagString, &oscSignature) != OscErrorNone) {
+        memcpy(oscMessage->arguments, &source[argumentsIndex], argumentsSize);
+        oscMessage->argumentsSize = argumentsSize;
+        return ValidateArgumentsSize(oscMessage);
+    }
+    if (oscSignature->isFixedSize == true) {
+        if (argumentsSize != oscSignature->argumentsSize) {
+            return OscErrorArgumentsSizeInconsistentWithTypeTagString; // error: arguments size does not match fixed-size arguments
+        }
+    } else {
+        if (argumentsSize < oscSignature->argumentsSize) {
+            return OscErrorArgumentsSizeInconsistentWithTypeTagString; // error: arguments size less than minimum size
+        }
+    }
+    memcpy(oscMessage->arguments, &source[argumentsIndex], argumentsSize);
+    oscMessage->argumentsSize = argumentsSize;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Parses a byte array into an OSC message without validating the
+ * arguments.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscMessage OSC message.
+ * @param source Byte array.
+ * @param numberOfBytes Number of bytes within the byte array.
+ * @return Error code (0 if successful).
+ */
+static OscError ParseCharArray(OscMessage * const oscMessage, const char * const source, const size_t numberOfBytes) {
+    size_t sourceIndex;
+    const OscError oscError = ParseAddressPatternAndTypeTagString(oscMessage, source, numberOfBytes, &sourceIndex);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+
+    // Arguments
+    while (sourceIndex < numberOfBytes) {
+        oscMessage->arguments[oscMessage->argumentsSize++] = source[sourceIndex++];
+    }
+
+    return OscErrorNone;
+}
+
+/**
+ * @brief Parses the OSC address pattern and OSC type tag string of a byte
+ * array into an OSC message.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscMessage OSC message.
+ * @param source Byte array.
+ * @param numberOfBytes Number of bytes within the byte array.
+ * @param argumentsIndex Index of the first argument within the byte array.
+ * @return Error code (0 if successful).
+ */
+static OscError ParseAddressPatternAndTypeTagString(OscMessage * const oscMessage, const char * const source, const size_t numberOfBytes, size_t * const argumentsIndex) {
     OscMessageInitialise(oscMessage, "");
 
     // Return error if not valid OSC message
@@ -750,14 +1154,79 @@ OscError OscMessageInitialiseFromCharArray(OscMessage * const oscMessage, const
         }
     } while (sourceIndex % 4 != 0);
 
-    // Arguments
-    while (sourceIndex < numberOfBytes) {
-        oscMessage->arguments[oscMessage->argumentsSize++] = source[sourceIndex++];
-    }
+    *argumentsIndex = sourceIndex;
+    return OscErrorNone;
+}
 
+/**
+ * @brief Validates the OSC type tag string and checks that the arguments size
+ * is consistent with it.
+ *
+ * Each type tag is classified using a lookup table.  The sizes of fixed-size
+ * arguments and the minimum sizes of variable-size arguments are summed so
+ * that a message containing only fixed-size arguments is validated with a
+ * single comparison.  A message containing variable-size arguments is
+ * validated against the minimum size and the remaining bytes are validated as
+ * each argument is read.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscMessage OSC message.
+ * @return Error code (0 if successful).
+ */
+static OscError ValidateArgumentsSize(const OscMessage * const oscMessage) {
+    size_t argumentsSize = 0;
+    unsigned char allClasses = TYPE_TAG_VALID; // valid flag cleared by any unknown type tag
+    unsigned char anyClasses = 0; // variable size flag set by any variable-size argument
+    unsigned int typeTagIndex;
+    for (typeTagIndex = 1; typeTagIndex < oscMessage->oscTypeTagStringLength; typeTagIndex++) { // skip comma
+        const unsigned char typeTag = (unsigned char) oscMessage->oscTypeTagString[typeTagIndex];
+        const unsigned char typeTagClass = typeTag < sizeof (typeTagClasses) ? typeTagClasses[typeTag] : 0;
+        allClasses &= typeTagClass;
+        anyClasses |= typeTagClass;
+        argumentsSize += typeTagClass & TYPE_TAG_SIZE_MASK;
+    }
+    if ((allClasses & TYPE_TAG_VALID) == 0) {
+        return OscErrorUnknownTypeTag; // error: type tag string contains unknown type tag
+    }
+    if ((anyClasses & TYPE_TAG_VARIABLE_SIZE) == 0) {
+        if (oscMessage->argumentsSize != argumentsSize) {
+            return OscErrorArgumentsSizeInconsistentWithTypeTagString; // error: arguments size does not match fixed-size arguments
+        }
+    } else {
+        if (oscMessage->argumentsSize < argumentsSize) {
+            return OscErrorArgumentsSizeInconsistentWithTypeTagString; // error: arguments size less than minimum size
+        }
+    }
     return OscErrorNone;
 }
 
+/**
+ * @brief Returns the index entry for an OSC type tag string.  The index entry
+ * will either contain the index of the OSC signature for the OSC type tag
+ * string or will be unused.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscSignatureRegistry OSC signature registry structure.
+ * @param oscTypeTagString OSC type tag string.
+ * @return Index entry.
+ */
+static unsigned int FindSignatureIndexEntry(const OscSignatureRegistry * const oscSignatureRegistry, const char * const oscTypeTagString) {
+    const uint64_t hash = OscHashBytes(oscTypeTagString, strlen(oscTypeTagString));
+
+    // Linear probing
+    unsigned int indexEntry = (unsigned int) (hash % OSC_SIGNATURE_INDEX_SIZE);
+    while (oscSignatureRegistry->index[indexEntry] != NO_INDEX) {
+        const OscSignature * const oscSignature = &oscSignatureRegistry->signatures[oscSignatureRegistry->index[indexEntry]];
+        if ((oscSignature->hash == hash) && (strcmp(oscSignature->oscTypeTagString, oscTypeTagString) == 0)) {
+            break;
+        }
+        indexEntry = (indexEntry + 1) % OSC_SIGNATURE_INDEX_SIZE;
+    }
+    return indexEntry;
+}
+
 /**
  * @brief Returns true if an argument is available indicated by the current
  * oscTypeTagStringIndex value.
@@ -1061,6 +1530,196 @@ OscError OscMessageGetBlob(OscMessage * const oscMessage, size_t * const blobSiz
     return OscErrorNone;
 }
 
+/**
+ * @brief Gets a numeric array from a blob argument of an OSC message.
+ *
+ * The next argument available within the OSC message must be a blob created by
+ * OscMessageAddNumericArray else this function will return an error.  The
+ * elements are not copied.  The numeric array provides the location of the
+ * elements within the OSC message and OscMessageConvertNumericArray may be
+ * used to convert the elements to a native array.  The internal index
+ * oscTypeTagStringIndex, will only be incremented to the next argument if this
+ * function is successful.
+ *
+ * Example use:
+ * @code
+ * OscNumericArray oscNumericArray;
+ * if(OscMessageGetNumericArray(&oscMessage, &oscNumericArray) == OscErrorNone) {
+ *     if(oscNumericArray.elementType == OscTypeTagFloat32) {
+ *         float meters[256];
+ *         OscMessageConvertNumericArray(&oscNumericArray, meters, sizeof(meters));
+ *     }
+ * }
+ * @endcode
+ *
+ * @param oscMessage OSC message.
+ * @param oscNumericArray Numeric array.
+ * @return Error code (0 if successful).
+ */
+OscError OscMessageGetNumericArray(OscMessage * const oscMessage, OscNumericArray * const oscNumericArray) {
+    if (oscMessage->oscTypeTagString[oscMessage->oscTypeTagStringIndex] == '\0') {
+        return OscErrorNoArgumentsAvailable; // error: end of type tag string
+    }
+    if (oscMessage->oscTypeTagString[oscMessage->oscTypeTagStringIndex] != OscTypeTagBlob) {
+        return OscErrorUnexpectedArgumentType; // error: unexpected argument type
+    }
+    if ((oscMessage->argumentsIndex + sizeof (OscArgument32)) > oscMessage->argumentsSize) {
+        return OscErrorMessageTooShortForArgumentType; // error: message too short to contain argument
+    }
+    unsigned int argumentsIndex = oscMessage->argumentsIndex; // local copy in case function returns error
+    OscArgument32 blobSize;
+    blobSize.byteStruct.byte3 = oscMessage->arguments[argumentsIndex++];
+    blobSize.byteStruct.byte2 = oscMessage->arguments[argumentsIndex++];
+    blobSize.byteStruct.byte1 = oscMessage->arguments[argumentsIndex++];
+    blobSize.byteStruct.byte0 = oscMessage->arguments[argumentsIndex++];
+    if (blobSize.int32 < 0) {
+        return OscErrorMessageTooShortForArgumentType; // error: invalid blob size
+    }
+    const size_t numberOfBytes = (size_t) blobSize.int32;
+    if (numberOfBytes > (oscMessage->argumentsSize - argumentsIndex)) {
+        return OscErrorMessageTooShortForArgumentType; // error: message too short to contain argument
+    }
+    if (numberOfBytes < OSC_NUMERIC_ARRAY_HEADER_SIZE) {
+        return OscErrorInvalidNumericArray; // error: blob too small to contain header
+    }
+    const char * const header = &oscMessage->arguments[argumentsIndex];
+    if ((header[0] != (char) OscTypeTagBeginArray) || (header[2] != '\0') || (header[3] != '\0')) {
+        return OscErrorInvalidNumericArray; // error: invalid header
+    }
+    const size_t elementSize = GetNumericArrayElementSize((OscTypeTag) header[1]);
+    if (elementSize == 0) {
+        return OscErrorUnsupportedNumericArrayType; // error: unsupported element type
+    }
+    OscArgument32 numberOfElements;
+    numberOfElements.byteStruct.byte3 = header[4];
+    numberOfElements.byteStruct.byte2 = header[5];
+    numberOfElements.byteStruct.byte1 = header[6];
+    numberOfElements.byteStruct.byte0 = header[7];
+    if ((numberOfElements.int32 < 0) || (((size_t) numberOfElements.int32 * elementSize) != (numberOfBytes - OSC_NUMERIC_ARRAY_HEADER_SIZE))) {
+        return OscErrorInvalidNumericArray; // error: number of elements inconsistent with blob size
+    }
+    oscNumericArray->elementType = (OscTypeTag) header[1];
+    oscNumericArray->numberOfElements = numberOfElements.int32;
+    oscNumericArray->elements = &header[OSC_NUMERIC_ARRAY_HEADER_SIZE];
+    argumentsIndex += numberOfBytes;
+    while ((argumentsIndex % 4) != 0) {
+        if (++argumentsIndex > oscMessage->argumentsSize) {
+            return OscErrorMessageTooShortForArgumentType; // error: message too short to contain argument
+        }
+    }
+    oscMessage->argumentsIndex = argumentsIndex;
+    oscMessage->oscTypeTagStringIndex++;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Converts the big-endian elements of a numeric array to a native
+ * array.
+ *
+ * The destination must be an array of int32_t, float, int64_t, or Double64 for
+ * an element type of OscTypeTagInt32, OscTypeTagFloat32, OscTypeTagInt64, or
+ * OscTypeTagDouble respectively.
+ *
+ * Example use:
+ * @code
+ * float meters[256];
+ * OscMessageConvertNumericArray(&oscNumericArray, meters, sizeof(meters));
+ * @endcode
+ *
+ * @param oscNumericArray Numeric array.
+ * @param destination Native array.
+ * @param destinationSize Size of the destination that cannot be exceeded.
+ * @return Error code (0 if successful).
+ */
+OscError OscMessageConvertNumericArray(const OscNumericArray * const oscNumericArray, void * const destination, const size_t destinationSize) {
+    const char * source = oscNumericArray->elements;
+    const size_t numberOfElements = oscNumericArray->numberOfElements;
+    size_t elementIndex;
+    switch (oscNumericArray->elementType) {
+        case OscTypeTagInt32:
+        case OscTypeTagFloat32:
+        {
+            if ((numberOfElements * sizeof (OscArgument32)) > destinationSize) {
+                return OscErrorDestinationTooSmall; // error: destination too small
+            }
+            OscArgument32 * const elements = (OscArgument32 *) destination;
+            for (elementIndex = 0; elementIndex < numberOfElements; elementIndex++) {
+                elements[elementIndex].byteStruct.byte3 = *source++;
+                elements[elementIndex].byteStruct.byte2 = *source++;
+                elements[elementIndex].byteStruct.byte1 = *source++;
+                elements[elementIndex].byteStruct.byte0 = *source++;
+            }
+            return OscErrorNone;
+        }
+        case OscTypeTagInt64:
+        {
+            if ((numberOfElements * sizeof (int64_t)) > destinationSize) {
+                return OscErrorDestinationTooSmall; // error: destination too small
+            }
+            int64_t * const elements = (int64_t *) destination;
+            for (elementIndex = 0; elementIndex < numberOfElements; elementIndex++) {
+                OscArgument64 oscArgument64;
+                oscArgument64.byteStruct.byte7 = *source++;
+                oscArgument64.byteStruct.byte6 = *source++;
+                oscArgument64.byteStruct.byte5 = *source++;
+                oscArgument64.byteStruct.byte4 = *source++;
+                oscArgument64.byteStruct.byte3 = *source++;
+                oscArgument64.byteStruct.byte2 = *source++;
+                oscArgument64.byteStruct.byte1 = *source++;
+                oscArgument64.byteStruct.byte0 = *source++;
+                elements[elementIndex] = (int64_t) oscArgument64.int64;
+            }
+            return OscErrorNone;
+        }
+        case OscTypeTagDouble:
+        {
+            if ((numberOfElements * sizeof (Double64)) > destinationSize) {
+                return OscErrorDestinationTooSmall; // error: destination too small
+            }
+            Double64 * const elements = (Double64 *) destination;
+            for (elementIndex = 0; elementIndex < numberOfElements; elementIndex++) {
+                OscArgument64 oscArgument64;
+                oscArgument64.byteStruct.byte7 = *source++;
+                oscArgument64.byteStruct.byte6 = *source++;
+                oscArgument64.byteStruct.byte5 = *source++;
+                oscArgument64.byteStruct.byte4 = *source++;
+                oscArgument64.byteStruct.byte3 = *source++;
+                oscArgument64.byteStruct.byte2 = *source++;
+                oscArgument64.byteStruct.byte1 = *source++;
+                oscArgument64.byteStruct.byte0 = *source++;
+                elements[elementIndex] = oscArgument64.double64;
+            }
+            return OscErrorNone;
+        }
+        default:
+            break;
+    }
+    return OscErrorUnsupportedNumericArrayType; // error: unsupported element type
+}
+
+/**
+ * @brief Returns the size (number of bytes) of each element of a numeric array
+ * of the specified element type.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param elementType OSC type tag of the elements.
+ * @return Size of each element, or zero if the element type is not supported.
+ */
+static size_t GetNumericArrayElementSize(const OscTypeTag elementType) {
+    switch (elementType) {
+        case OscTypeTagInt32:
+        case OscTypeTagFloat32:
+            return sizeof (OscArgument32);
+        case OscTypeTagInt64:
+        case OscTypeTagDouble:
+            return sizeof (OscArgument64);
+        default:
+            break;
+    }
+    return 0;
+}
+
 /**
  * @brief Gets a 64-bit integer argument from an OSC message.
  *
@@ -2232,5 +2891,216 @@ OscError OscMessageGetArgumentAsBool(OscMessage * const oscMessage, bool * const
     return OscErrorNone;
 }
 
+/**
+ * @brief Interprets all remaining arguments in the OSC message as float32 even
+ * if the arguments are of other types.
+ *
+ * This function is equivalent to calling OscMessageGetArgumentAsFloat32 for
+ * each remaining argument but walks the OSC type tag string once and converts
+ * each run of int32 or float32 arguments in a single loop.  Conversion stops at
+ * the first argument that is not of a numerical type, in which case the
+ * internal index oscTypeTagStringIndex will indicate that argument.  The
+ * number of arguments converted is provided in all cases.
+ *
+ * Example use:
+ * @code
+ * float values[MAX_NUMBER_OF_ARGUMENTS];
+ * size_t numberOfValues;
+ * OscMessageGetAllAsFloat32(&oscMessage, values, MAX_NUMBER_OF_ARGUMENTS, &numberOfValues);
+ * @endcode
+ *
+ * @param oscMessage OSC message.
+ * @param destination Destination array.
+ * @param destinationLength Number of elements in the destination array.
+ * @param numberOfArguments Number of arguments converted.
+ * @return Error code (0 if successful).
+ */
+OscError OscMessageGetAllAsFloat32(OscMessage * const oscMessage, float * const destination, const size_t destinationLength, size_t * const numberOfArguments) {
+    size_t destinationIndex = 0;
+    while (OscMessageIsArgumentAvailable(oscMessage) == true) {
+        if (destinationIndex >= destinationLength) {
+            *numberOfArguments = destinationIndex;
+            return OscErrorDestinationTooSmall; // error: destination too small
+        }
+
+        // Convert run of int32 or float32 arguments
+        const char * source = &oscMessage->arguments[oscMessage->argumentsIndex];
+        size_t runLength = 0;
+        size_t runIndex;
+        switch (oscMessage->oscTypeTagString[oscMessage->oscTypeTagStringIndex]) {
+            case OscTypeTagInt32:
+                runLength = GetRunLength(oscMessage, sizeof (OscArgument32), destinationLength - destinationIndex);
+                for (runIndex = 0; runIndex < runLength; runIndex++) {
+                    OscArgument32 oscArgument32;
+                    oscArgument32.byteStruct.byte3 = *source++;
+                    oscArgument32.byteStruct.byte2 = *source++;
+                    oscArgument32.byteStruct.byte1 = *source++;
+                    oscArgument32.byteStruct.byte0 = *source++;
+                    destination[destinationIndex++] = (float) oscArgument32.int32;
+                }
+                break;
+            case OscTypeTagFloat32:
+                runLength = GetRunLength(oscMessage, sizeof (OscArgument32), destinationLength - destinationIndex);
+                for (runIndex = 0; runIndex < runLength; runIndex++) {
+                    OscArgument32 oscArgument32;
+                    oscArgument32.byteStruct.byte3 = *source++;
+                    oscArgument32.byteStruct.byte2 = *source++;
+                    oscArgument32.byteStruct.byte1 = *source++;
+                    oscArgument32.byteStruct.byte0 = *source++;
+                    destination[destinationIndex++] = oscArgument32.float32;
+                }
+                break;
+            default:
+                break;
+        }
+        if (runLength > 0) {
+            oscMessage->argumentsIndex += (unsigned int) (runLength * sizeof (OscArgument32));
+            oscMessage->oscTypeTagStringIndex += (unsigned int) runLength;
+            continue;
+        }
+
+        // Convert other argument
+        const unsigned int oscTypeTagStringIndex = oscMessage->oscTypeTagStringIndex;
+        const OscError oscError = OscMessageGetArgumentAsFloat32(oscMessage, &destination[destinationIndex]);
+        if (oscError != OscErrorNone) {
+            *numberOfArguments = destinationIndex;
+            return oscError;
+        }
+        if (oscMessage->oscTypeTagStringIndex == oscTypeTagStringIndex) {
+            oscMessage->oscTypeTagStringIndex++; // arguments without data, such as true, are not skipped by OscMessageGetArgumentAsFloat32
+        }
+        destinationIndex++;
+    }
+    *numberOfArguments = destinationIndex;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Interprets all remaining arguments in the OSC message as 64-bit
+ * doubles even if the arguments are of other types.
+ *
+ * This function is equivalent to calling OscMessageGetArgumentAsDouble for
+ * each remaining argument but walks the OSC type tag string once and converts
+ * each run of int32, float32, or 64-bit double arguments in a single loop.
+ * Conversion stops at the first argument that is not of a numerical type, in
+ * which case the internal index oscTypeTagStringIndex will indicate that
+ * argument.  The number of arguments converted is provided in all cases.
+ *
+ * Example use:
+ * @code
+ * Double64 values[MAX_NUMBER_OF_ARGUMENTS];
+ * size_t numberOfValues;
+ * OscMessageGetAllAsDouble(&oscMessage, values, MAX_NUMBER_OF_ARGUMENTS, &numberOfValues);
+ * @endcode
+ *
+ * @param oscMessage OSC message.
+ * @param destination Destination array.
+ * @param destinationLength Number of elements in the destination array.
+ * @param numberOfArguments Number of arguments converted.
+ * @return Error code (0 if successful).
+ */
+OscError OscMessageGetAllAsDouble(OscMessage * const oscMessage, Double64 * const destination, const size_t destinationLength, size_t * const numberOfArguments) {
+    size_t destinationIndex = 0;
+    while (OscMessageIsArgumentAvailable(oscMessage) == true) {
+        if (destinationIndex >= destinationLength) {
+            *numberOfArguments = destinationIndex;
+            return OscErrorDestinationTooSmall; // error: destination too small
+        }
+
+        // Convert run of int32, float32, or double arguments
+        const char * source = &oscMessage->arguments[oscMessage->argumentsIndex];
+        size_t runLength = 0;
+        size_t runIndex;
+        switch (oscMessage->oscTypeTagString[oscMessage->oscTypeTagStringIndex]) {
+            case OscTypeTagInt32:
+                runLength = GetRunLength(oscMessage, sizeof (OscArgument32), destinationLength - destinationIndex);
+                for (runIndex = 0; runIndex < runLength; runIndex++) {
+                    OscArgument32 oscArgument32;
+                    oscArgument32.byteStruct.byte3 = *source++;
+                    oscArgument32.byteStruct.byte2 = *source++;
+                    oscArgument32.byteStruct.byte1 = *source++;
+                    oscArgument32.byteStruct.byte0 = *source++;
+                    destination[destinationIndex++] = (Double64) oscArgument32.int32;
+                }
+                oscMessage->argumentsIndex += (unsigned int) (runLength * sizeof (OscArgument32));
+                break;
+            case OscTypeTagFloat32:
+                runLength = GetRunLength(oscMessage, sizeof (OscArgument32), destinationLength - destinationIndex);
+                for (runIndex = 0; runIndex < runLength; runIndex++) {
+                    OscArgument32 oscArgument32;
+                    oscArgument32.byteStruct.byte3 = *source++;
+                    oscArgument32.byteStruct.byte2 = *source++;
+                    oscArgument32.byteStruct.byte1 = *source++;
+                    oscArgument32.byteStruct.byte0 = *source++;
+                    destination[destinationIndex++] = (Double64) oscArgument32.float32;
+                }
+                oscMessage->argumentsIndex += (unsigned int) (runLength * sizeof (OscArgument32));
+                break;
+            case OscTypeTagDouble:
+                runLength = GetRunLength(oscMessage, sizeof (OscArgument64), destinationLength - destinationIndex);
+                for (runIndex = 0; runIndex < runLength; runIndex++) {
+                    OscArgument64 oscArgument64;
+                    oscArgument64.byteStruct.byte7 = *source++;
+                    oscArgument64.byteStruct.byte6 = *source++;
+                    oscArgument64.byteStruct.byte5 = *source++;
+                    oscArgument64.byteStruct.byte4 = *source++;
+                    oscArgument64.byteStruct.byte3 = *source++;
+                    oscArgument64.byteStruct.byte2 = *source++;
+                    oscArgument64.byteStruct.byte1 = *source++;
+                    oscArgument64.byteStruct.byte0 = *source++;
+                    destination[destinationIndex++] = oscArgument64.double64;
+                }
+                oscMessage->argumentsIndex += (unsigned int) (runLength * sizeof (OscArgument64));
+                break;
+            default:
+                break;
+        }
+        if (runLength > 0) {
+            oscMessage->oscTypeTagStringIndex += (unsigned int) runLength;
+            continue;
+        }
+
+        // Convert other argument
+        const unsigned int oscTypeTagStringIndex = oscMessage->oscTypeTagStringIndex;
+        const OscError oscError = OscMessageGetArgumentAsDouble(oscMessage, &destination[destinationIndex]);
+        if (oscError != OscErrorNone) {
+            *numberOfArguments = destinationIndex;
+            return oscError;
+        }
+        if (oscMessage->oscTypeTagStringIndex == oscTypeTagStringIndex) {
+            oscMessage->oscTypeTagStringIndex++; // arguments without data, such as true, are not skipped by OscMessageGetArgumentAsDouble
+        }
+        destinationIndex++;
+    }
+    *numberOfArguments = destinationIndex;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Returns the number of consecutive arguments, starting at the current
+ * oscTypeTagStringIndex value, with the same type tag as the current argument.
+ * The run length is limited by the maximum run length and by the number of
+ * arguments of the specified size that the remaining arguments may contain.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscMessage OSC message.
+ * @param argumentSize Size of each argument.
+ * @param maximumRunLength Maximum run length.
+ * @return Run length.
+ */
+static size_t GetRunLength(const OscMessage * const oscMessage, const size_t argumentSize, const size_t maximumRunLength) {
+    size_t maximum = (oscMessage->argumentsSize - oscMessage->argumentsIndex) / argumentSize;
+    if (maximum > maximumRunLength) {
+        maximum = maximumRunLength;
+    }
+    const char * const typeTag = &oscMessage->oscTypeTagString[oscMessage->oscTypeTagStringIndex];
+    size_t runLength = 0;
+    while ((runLength < maximum) && (typeTag[runLength] == typeTag[0])) {
+        runLength++;
+    }
+    return runLength;
+}
+
 //------------------------------------------------------------------------------
 // End of file
@@ -4,8 +4,8 @@
  * @brief Functions and structures for constructing and deconstructing OSC
  * messages.
  *
- * MAX_OSC_ADDRESS_PATTERN_LENGTH and MAX_NUMBER_OF_ARGUMENTS may be modified as
- * required by the user application.
+ * MAX_OSC_ADDRESS_PATTERN_LENGTH, MAX_NUMBER_OF_ARGUMENTS, and
+ * MAX_OSC_SIGNATURES may be modified as required by the user application.
  *
  * @see http://opensoundcontrol.org/spec-1_0
  */
@@ -65,6 +65,26 @@
  */
 #define MAX_ARGUMENTS_SIZE (MAX_OSC_MESSAGE_SIZE - (MAX_OSC_ADDRESS_PATTERN_LENGTH + 4) - (MAX_OSC_TYPE_TAG_STRING_LENGTH + 4))
 
+/**
+ * @brief Size (number of bytes) of the header at the start of a numeric array
+ * blob.  The header is the character '[', the OSC type tag of the elements,
+ * two null characters, and the number of elements as a 32-bit integer.
+ */
+#define OSC_NUMERIC_ARRAY_HEADER_SIZE (8)
+
+/**
+ * @brief Maximum number of distinct OSC type tag strings that may be contained
+ * within an OSC signature registry.  This value may be modified as required by
+ * the user application.
+ */
+#define MAX_OSC_SIGNATURES (32)
+
+/**
+ * @brief Size of the OSC signature registry hash index.  The index is twice the
+ * maximum number of signatures to keep probe sequences short.
+ */
+#define OSC_SIGNATURE_INDEX_SIZE (2 * MAX_OSC_SIGNATURES)
+
 /**
  * @brief OSC message structure.  Structure members are used internally and
  * should not be used by the user application.
@@ -103,6 +123,45 @@ typedef enum {
     OscTypeTagEndArray = ']',
 } OscTypeTag;
 
+/**
+ * @brief Numeric array contained within a blob argument.  The elements are
+ * big-endian and remain within the OSC message.  The OSC message must not be
+ * modified while the numeric array is in use.
+ */
+typedef struct {
+    OscTypeTag elementType; // OscTypeTagInt32, OscTypeTagFloat32, OscTypeTagInt64, or OscTypeTagDouble
+    size_t numberOfElements;
+    const char * elements;
+} OscNumericArray;
+
+/**
+ * @brief OSC signature structure describing the argument layout of an OSC type
+ * tag string.  The offset of each argument is known up to and including the
+ * first variable-size argument.
+ */
+typedef struct {
+    char oscTypeTagString[MAX_OSC_TYPE_TAG_STRING_LENGTH + 1]; // includes comma.  Null terminated
+    size_t oscTypeTagStringLength; // includes comma but not null characters
+    uint64_t hash;
+    bool isValid; // all type tags are known
+    bool isFixedSize; // no strings or blobs
+    size_t argumentsSize; // exact size if fixed size, else minimum size
+    unsigned int numberOfArguments;
+    unsigned int numberOfKnownOffsets;
+    unsigned int argumentOffsets[MAX_NUMBER_OF_ARGUMENTS];
+    unsigned char argumentSizes[MAX_NUMBER_OF_ARGUMENTS]; // minimum size if variable size
+} OscSignature;
+
+/**
+ * @brief OSC signature registry structure.  Structure members are used
+ * internally and should not be used by the user application.
+ */
+typedef struct {
+    OscSignature signatures[MAX_OSC_SIGNATURES];
+    unsigned int numberOfSignatures;
+    unsigned int index[OSC_SIGNATURE_INDEX_SIZE]; // signature indexes
+} OscSignatureRegistry;
+
 //------------------------------------------------------------------------------
 // Function prototypes
 
@@ -114,6 +173,7 @@ OscError OscMessageAddInt32(OscMessage * const oscMessage, const int32_t int32);
 OscError OscMessageAddFloat32(OscMessage * const oscMessage, const float float32);
 OscError OscMessageAddString(OscMessage * const oscMessage, const char * string);
 OscError OscMessageAddBlob(OscMessage * const oscMessage, const char * const source, const size_t numberOfBytes);
+OscError OscMessageAddNumericArray(OscMessage * const oscMessage, const OscTypeTag elementType, const void * const source, const size_t numberOfElements);
 OscError OscMessageAddInt64(OscMessage * const oscMessage, const uint64_t int64);
 OscError OscMessageAddTimeTag(OscMessage * const oscMessage, const OscTimeTag oscTimeTag);
 OscError OscMessageAddDouble(OscMessage * const oscMessage, const Double64 double64);
@@ -131,6 +191,11 @@ OscError OscMessageToCharArray(const OscMessage * const oscMessage, size_t * con
 
 // Message deconstruction
 OscError OscMessageInitialiseFromCharArray(OscMessage * const oscMessage, const char * const source, const size_t size);
+OscError OscSignatureInitialise(OscSignature * const oscSignature, const char * const oscTypeTagString);
+void OscSignatureRegistryInitialise(OscSignatureRegistry * const oscSignatureRegistry);
+OscError OscSignatureRegistryAdd(OscSignatureRegistry * const oscSignatureRegistry, const char * const oscTypeTagString);
+OscError OscSignatureRegistryFind(const OscSignatureRegistry * const oscSignatureRegistry, const char * const oscTypeTagString, const OscSignature * * const oscSignature);
+OscError OscMessageInitialiseFromCharArrayWithSignatures(OscMessage * const oscMessage, const OscSignatureRegistry * const oscSignatureRegistry, const char * const source, const size_t size);
 bool OscMessageIsArgumentAvailable(OscMessage * const oscMessage);
 OscTypeTag OscMessageGetArgumentType(OscMessage * const oscMessage);
 OscError OscMessageSkipArgument(OscMessage * const oscMessage);
@@ -138,6 +203,8 @@ OscError OscMessageGetInt32(OscMessage * const oscMessage, int32_t * const int32
 OscError OscMessageGetFloat32(OscMessage * const oscMessage, float * const float32);
 OscError OscMessageGetString(OscMessage * const oscMessage, char * const destination, const size_t destinationSize);
 OscError OscMessageGetBlob(OscMessage * const oscMessage, size_t * const blobSize, char * const destination, const size_t destinationSize);
+OscError OscMessageGetNumericArray(OscMessage * const oscMessage, OscNumericArray * const oscNumericArray);
+OscError OscMessageConvertNumericArray(const OscNumericArray * const oscNumericArray, void * const destination, const size_t destinationSize);
 OscError OscMessageGetInt64(OscMessage * const oscMessage, int64_t * const int64);
 OscError OscMessageGetTimeTag(OscMessage * const oscMessage, OscTimeTag * const oscTimeTag);
 OscError OscMessageGetDouble(OscMessage * const oscMessage, Double64 * const double64);
@@ -155,6 +222,8 @@ OscError OscMessageGetArgumentAsCharacter(OscMessage * const oscMessage, char *
 OscError OscMessageGetArgumentAsRgbaColour(OscMessage * const oscMessage, RgbaColour * const rgbaColour);
 OscError OscMessageGetArgumentAsMidiMessage(OscMessage * const oscMessage, MidiMessage * const midiMessage);
 OscError OscMessageGetArgumentAsBool(OscMessage * const oscMessage, bool * const boolean);
+OscError OscMessageGetAllAsFloat32(OscMessage * const oscMessage, float * const destination, const size_t destinationLength, size_t * const numberOfArguments);
+OscError OscMessageGetAllAsDouble(OscMessage * const oscMessage, Double64 * const destination, const size_t destinationLength, size_t * const numberOfArguments);
 
 #endif
 
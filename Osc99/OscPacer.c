@@ -0,0 +1,260 @@
+/**
+ * @file OscPacer.c
+ * @author Seb Madgwick
+ * @brief Functions and structures for pacing the transmission of OSC packets
+ * according to the OSC time tag of each OSC bundle.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscBundle.h"
+#include "OscPacer.h"
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static bool IsImmediate(const OscTimeTag * const oscTimeTag);
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Initialises an OSC pacer.
+ *
+ * An OSC pacer must be initialised before use.  A SendPacket function must be
+ * implemented within the application and assigned to the OSC pacer structure
+ * after initialisation.  The lead is subtracted from the OSC time tag of each
+ * OSC bundle to determine the departure time of the OSC packet.  The lead
+ * should account for the transport latency so that OSC bundles arrive shortly
+ * before they are due.
+ *
+ * Example use:
+ * @code
+ * void SendPacket(void* param, const OscTimeTag * const departureTime, const char * const source, const size_t numberOfBytes) {
+ * }
+ *
+ * void Main() {
+ *     OscTimeTag lead;
+ *     lead.value = 0x100000000 / 100; // 10 ms
+ *     OscPacer oscPacer;
+ *     OscPacerInitialise(&oscPacer, lead);
+ *     oscPacer.sendPacket = SendPacket;
+ * }
+ * @endcode
+ *
+ * @param oscPacer OSC pacer to be initialised.
+ * @param lead Time subtracted from the OSC time tag of each OSC bundle.
+ */
+void OscPacerInitialise(OscPacer * const oscPacer, const OscTimeTag lead) {
+    OscPacerClear(oscPacer);
+    oscPacer->lead = lead;
+    oscPacer->sendPacket = NULL;
+    oscPacer->param = NULL;
+}
+
+/**
+ * @brief Adds an OSC packet to the OSC pacer.
+ *
+ * An OSC packet containing an OSC message or an OSC bundle with an OSC time tag
+ * indicating "immediately" is sent immediately with a NULL departure time.  An
+ * OSC packet containing an OSC bundle is otherwise queued until the departure
+ * time is reached.  OscPacerProcess must be called periodically to send queued
+ * OSC packets.
+ *
+ * The departure time is provided to the SendPacket function so that the
+ * application may pass it to the transport layer.  For example, a Linux
+ * application may set a large lead and provide the departure time to the
+ * kernel using SO_TXTIME.
+ *
+ * Example use:
+ * @code
+ * OscPacket oscPacket;
+ * OscPacketInitialiseFromContents(&oscPacket, &oscBundle);
+ * OscPacerAddPacket(&oscPacer, &oscPacket);
+ * @endcode
+ *
+ * @param oscPacer OSC pacer.
+ * @param oscPacket OSC packet to be sent.
+ * @return Error code (0 if successful).
+ */
+OscError OscPacerAddPacket(OscPacer * const oscPacer, const OscPacket * const oscPacket) {
+    if (oscPacer->sendPacket == NULL) {
+        return OscErrorCallbackFunctionUndefined; // error: user function undefined
+    }
+    if (oscPacket->size == 0) {
+        return OscErrorContentsEmpty; // error: contents empty
+    }
+
+    // Send OSC message immediately
+    if (OscContentsIsMessage(oscPacket->contents) == true) {
+        oscPacer->sendPacket(oscPacer->param, NULL, oscPacket->contents, oscPacket->size);
+        return OscErrorNone;
+    }
+    if (OscContentsIsBundle(oscPacket->contents) == false) {
+        return OscErrorInvalidContents; // error: invalid or uninitialised contents
+    }
+    if (oscPacket->size < MIN_OSC_BUNDLE_SIZE) {
+        return OscErrorBundleSizeTooSmall; // error: too few bytes to contain bundle
+    }
+
+    // Get OSC time tag from OSC bundle
+    OscTimeTag departureTime;
+    unsigned int sourceIndex = sizeof (OSC_BUNDLE_HEADER);
+    departureTime.byteStruct.byte7 = oscPacket->contents[sourceIndex++];
+    departureTime.byteStruct.byte6 = oscPacket->contents[sourceIndex++];
+    departureTime.byteStruct.byte5 = oscPacket->contents[sourceIndex++];
+    departureTime.byteStruct.byte4 = oscPacket->contents[sourceIndex++];
+    departureTime.byteStruct.byte3 = oscPacket->contents[sourceIndex++];
+    departureTime.byteStruct.byte2 = oscPacket->contents[sourceIndex++];
+    departureTime.byteStruct.byte1 = oscPacket->contents[sourceIndex++];
+    departureTime.byteStruct.byte0 = oscPacket->contents[sourceIndex++];
+
+    // Send OSC bundle immediately
+    if (IsImmediate(&departureTime) == true) {
+        oscPacer->sendPacket(oscPacer->param, NULL, oscPacket->contents, oscPacket->size);
+        return OscErrorNone;
+    }
+
+    // Subtract lead
+    if (departureTime.value > oscPacer->lead.value) {
+        departureTime.value -= oscPacer->lead.value;
+    } else {
+        departureTime.value = 0; // departure time has already passed
+    }
+
+    // Find unused entry
+    if (oscPacer->queueLength >= OSC_PACER_QUEUE_LENGTH) {
+        return OscErrorPacerQueueFull; // error: queue full
+    }
+    unsigned int entryIndex = 0;
+    while (oscPacer->isEntryUsed[entryIndex] == true) {
+        entryIndex++;
+    }
+    OscPacerEntry * const entry = &oscPacer->entries[entryIndex];
+    for (entry->size = 0; entry->size < oscPacket->size; entry->size++) {
+        entry->contents[entry->size] = oscPacket->contents[entry->size];
+    }
+    entry->departureTime = departureTime;
+    oscPacer->isEntryUsed[entryIndex] = true;
+
+    // Insert into queue after all entries with the same or earlier departure time
+    unsigned int queueIndex = oscPacer->queueLength;
+    while ((queueIndex > 0) && (oscPacer->entries[oscPacer->queue[queueIndex - 1]].departureTime.value > departureTime.value)) {
+        oscPacer->queue[queueIndex] = oscPacer->queue[queueIndex - 1];
+        queueIndex--;
+    }
+    oscPacer->queue[queueIndex] = entryIndex;
+    oscPacer->queueLength++;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Sends each queued OSC packet with a departure time that has been
+ * reached.
+ *
+ * This function should be called periodically with the current time.  OSC
+ * packets are sent in order of departure time.  OSC packets with the same
+ * departure time are sent in the order in which they were added.
+ *
+ * Example use:
+ * @code
+ * while(true) {
+ *     OscPacerProcess(&oscPacer, MyGetCurrentTime());
+ * }
+ * @endcode
+ *
+ * @param oscPacer OSC pacer.
+ * @param currentTime Current time.
+ * @return Error code (0 if successful).
+ */
+OscError OscPacerProcess(OscPacer * const oscPacer, const OscTimeTag currentTime) {
+    if (oscPacer->sendPacket == NULL) {
+        return OscErrorCallbackFunctionUndefined; // error: user function undefined
+    }
+    unsigned int numberOfEntriesSent = 0;
+    while (numberOfEntriesSent < oscPacer->queueLength) {
+        const unsigned int entryIndex = oscPacer->queue[numberOfEntriesSent];
+        const OscPacerEntry * const entry = &oscPacer->entries[entryIndex];
+        if (entry->departureTime.value > currentTime.value) {
+            break; // remaining entries not yet due
+        }
+        oscPacer->sendPacket(oscPacer->param, &entry->departureTime, entry->contents, entry->size);
+        oscPacer->isEntryUsed[entryIndex] = false;
+        numberOfEntriesSent++;
+    }
+
+    // Remove sent entries from queue
+    if (numberOfEntriesSent > 0) {
+        unsigned int queueIndex;
+        for (queueIndex = numberOfEntriesSent; queueIndex < oscPacer->queueLength; queueIndex++) {
+            oscPacer->queue[queueIndex - numberOfEntriesSent] = oscPacer->queue[queueIndex];
+        }
+        oscPacer->queueLength -= numberOfEntriesSent;
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Gets the departure time of the next queued OSC packet.
+ *
+ * An example use of this function would be to determine how long the
+ * application may sleep before OscPacerProcess must next be called.
+ *
+ * Example use:
+ * @code
+ * OscTimeTag departureTime;
+ * if(OscPacerGetNextDepartureTime(&oscPacer, &departureTime) == true) {
+ *     MySleepUntil(departureTime);
+ * }
+ * @endcode
+ *
+ * @param oscPacer OSC pacer.
+ * @param departureTime Departure time of the next queued OSC packet.
+ * @return True if an OSC packet is queued.
+ */
+bool OscPacerGetNextDepartureTime(const OscPacer * const oscPacer, OscTimeTag * const departureTime) {
+    if (oscPacer->queueLength == 0) {
+        return false;
+    }
+    *departureTime = oscPacer->entries[oscPacer->queue[0]].departureTime;
+    return true;
+}
+
+/**
+ * @brief Discards all queued OSC packets.
+ *
+ * Example use:
+ * @code
+ * OscPacerClear(&oscPacer);
+ * @endcode
+ *
+ * @param oscPacer OSC pacer.
+ */
+void OscPacerClear(OscPacer * const oscPacer) {
+    unsigned int entryIndex;
+    for (entryIndex = 0; entryIndex < OSC_PACER_QUEUE_LENGTH; entryIndex++) {
+        oscPacer->isEntryUsed[entryIndex] = false;
+    }
+    oscPacer->queueLength = 0;
+}
+
+/**
+ * @brief Returns true if the OSC time tag indicates "immediately".
+ *
+ * The OSC specification defines an OSC time tag value of 1 as "immediately".
+ * An OSC time tag value of zero is also interpreted as "immediately" for
+ * consistency with oscTimeTagZero.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscTimeTag OSC time tag.
+ * @return True if the OSC time tag indicates "immediately".
+ */
+static bool IsImmediate(const OscTimeTag * const oscTimeTag) {
+    return oscTimeTag->value <= 1;
+}
+
+//------------------------------------------------------------------------------
+// End of file
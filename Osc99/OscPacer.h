@@ -0,0 +1,69 @@
+/**
+ * @file OscPacer.h
+ * @author Seb Madgwick
+ * @brief Functions and structures for pacing the transmission of OSC packets
+ * according to the OSC time tag of each OSC bundle.
+ *
+ * OSC_PACER_QUEUE_LENGTH may be modified as required by the user application.
+ *
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_PACER_H
+#define OSC_PACER_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscPacket.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Maximum number of OSC packets that may be queued for transmission.
+ * This value may be modified as required by the user application.
+ */
+#define OSC_PACER_QUEUE_LENGTH (4)
+
+/**
+ * @brief OSC pacer entry structure.  This structure is used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    char contents[MAX_OSC_PACKET_SIZE];
+    size_t size;
+    OscTimeTag departureTime;
+} OscPacerEntry;
+
+/**
+ * @brief OSC pacer structure.  Structure members are used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    OscPacerEntry entries[OSC_PACER_QUEUE_LENGTH];
+    bool isEntryUsed[OSC_PACER_QUEUE_LENGTH];
+    unsigned int queue[OSC_PACER_QUEUE_LENGTH]; // entry indexes in order of departure time
+    unsigned int queueLength;
+    OscTimeTag lead;
+    void ( *sendPacket)(void* param, const OscTimeTag * const departureTime, const char * const source, const size_t numberOfBytes);
+    void* param;
+} OscPacer;
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+void OscPacerInitialise(OscPacer * const oscPacer, const OscTimeTag lead);
+OscError OscPacerAddPacket(OscPacer * const oscPacer, const OscPacket * const oscPacket);
+OscError OscPacerProcess(OscPacer * const oscPacer, const OscTimeTag currentTime);
+bool OscPacerGetNextDepartureTime(const OscPacer * const oscPacer, OscTimeTag * const departureTime);
+void OscPacerClear(OscPacer * const oscPacer);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
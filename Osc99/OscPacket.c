@@ -11,11 +11,39 @@
 
 #include "OscPacket.h"
 #include <stdbool.h>
+#include <string.h> // memchr, memcmp
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Deconstruction state reused for each OSC message within one or more
+ * OSC packets.
+ */
+typedef struct {
+    OscMessage oscMessage;
+    unsigned int numberOfMessages;
+} Deconstructor;
+
+/**
+ * @brief OSC message view collector structure.  Collects OSC message views
+ * until full and then provides them to the ProcessMessages function.
+ */
+typedef struct {
+    OscMessageView oscMessageViews[MAX_OSC_MESSAGE_VIEWS];
+    unsigned int numberOfViews;
+    void ( *processMessages)(void* param, const OscMessageView * const oscMessageViews, const unsigned int numberOfViews);
+    void* param;
+    unsigned int numberOfMessages;
+} ViewCollector;
 
 //------------------------------------------------------------------------------
 // Function prototypes
 
-static OscError DeconstructContents(OscPacket * const oscPacket, const OscTimeTag * const oscTimeTag, const void * const oscContents, const size_t contentsSize);
+static OscError DeconstructContents(OscPacket * const oscPacket, Deconstructor * const deconstructor, const OscTimeTag * const oscTimeTag, const void * const oscContents, const size_t contentsSize);
+static OscError CollectViews(ViewCollector * const viewCollector, const OscTimeTag * const oscTimeTag, const char * const oscContents, const size_t contentsSize);
+static OscError InitialiseView(OscMessageView * const oscMessageView, const char * const oscContents, const size_t contentsSize);
+static void ProcessViews(ViewCollector * const viewCollector);
 
 //------------------------------------------------------------------------------
 // Functions
@@ -45,6 +73,9 @@ static OscError DeconstructContents(OscPacket * const oscPacket, const OscTimeTa
 void OscPacketInitialise(OscPacket * const oscPacket) {
     oscPacket->size = 0;
     oscPacket->processMessage = NULL;
+    oscPacket->processMessages = NULL;
+    oscPacket->oscSignatureRegistry = NULL;
+    oscPacket->oscTemplates = NULL;
 }
 
 /**
@@ -69,6 +100,9 @@ void OscPacketInitialise(OscPacket * const oscPacket) {
  */
 OscError OscPacketInitialiseFromContents(OscPacket * const oscPacket, const void * const oscContents) {
     oscPacket->processMessage = NULL;
+    oscPacket->processMessages = NULL;
+    oscPacket->oscSignatureRegistry = NULL;
+    oscPacket->oscTemplates = NULL;
     if (OscContentsIsMessage(oscContents) == true) {
         return OscMessageToCharArray((OscMessage *) oscContents, &oscPacket->size, oscPacket->contents, MAX_OSC_PACKET_SIZE);
     }
@@ -107,6 +141,9 @@ OscError OscPacketInitialiseFromCharArray(OscPacket * const oscPacket, const cha
         oscPacket->size++;
     }
     oscPacket->processMessage = NULL;
+    oscPacket->processMessages = NULL;
+    oscPacket->oscSignatureRegistry = NULL;
+    oscPacket->oscTemplates = NULL;
     return OscErrorNone;
 }
 
@@ -141,7 +178,137 @@ OscError OscPacketProcessMessages(OscPacket * const oscPacket) {
     if (oscPacket->processMessage == NULL) {
         return OscErrorCallbackFunctionUndefined; // error: user function undefined
     }
-    return DeconstructContents(oscPacket, NULL, oscPacket->contents, oscPacket->size);
+    Deconstructor deconstructor;
+    deconstructor.numberOfMessages = 0;
+    return DeconstructContents(oscPacket, &deconstructor, NULL, oscPacket->contents, oscPacket->size);
+}
+
+/**
+ * @brief Processes the OSC packet to provide the OSC messages contained within
+ * the packet to the user application as arrays of OSC message views.
+ *
+ * A ProcessMessages function must be implemented within the application and
+ * assigned to the OSC packet structure after initialisation.  The
+ * ProcessMessages function is called with up to MAX_OSC_MESSAGE_VIEWS OSC
+ * message views at a time, in the order in which the OSC messages appear
+ * within the OSC packet.  The OSC messages are not copied or deconstructed.
+ * Each OSC message view indicates the number of consecutive OSC messages with
+ * an identical OSC address pattern and OSC type tag string so that the
+ * application may process each run of similar OSC messages together.  OSC
+ * message views are only valid for the duration of the call.
+ *
+ * Example use:
+ * @code
+ * void ProcessMessages(void* param, const OscMessageView * const oscMessageViews, const unsigned int numberOfViews) {
+ *     unsigned int viewIndex = 0;
+ *     while(viewIndex < numberOfViews) {
+ *         const OscMessageView * const run = &oscMessageViews[viewIndex];
+ *         MyProcessRun(run, run->runLength);
+ *         viewIndex += run->runLength;
+ *     }
+ * }
+ *
+ * void Main() {
+ *     oscPacket.processMessages = ProcessMessages;
+ *     OscPacketProcessMessageViews(&oscPacket);
+ * }
+ * @endcode
+ *
+ * @param oscPacket OSC packet to be processed.
+ * @return Error code (0 if successful).
+ */
+OscError OscPacketProcessMessageViews(OscPacket * const oscPacket) {
+    if (oscPacket->processMessages == NULL) {
+        return OscErrorCallbackFunctionUndefined; // error: user function undefined
+    }
+    ViewCollector viewCollector;
+    viewCollector.numberOfViews = 0;
+    viewCollector.processMessages = oscPacket->processMessages;
+    viewCollector.param = oscPacket->param;
+    viewCollector.numberOfMessages = 0;
+    const OscError oscError = CollectViews(&viewCollector, NULL, oscPacket->contents, oscPacket->size);
+    ProcessViews(&viewCollector); // provide OSC message views collected before any error
+    return oscError;
+}
+
+/**
+ * @brief Processes multiple OSC packets in order.
+ *
+ * This function is equivalent to calling OscPacketProcessMessageViews for each
+ * OSC packet with a ProcessMessages function, or OscPacketProcessMessages
+ * otherwise, and is typically of use after receiving multiple OSC packets at
+ * once, for example, with recvmmsg.  The start of the next OSC packet is
+ * prefetched while each OSC packet is processed and deconstruction state is
+ * reused between OSC packets.  OSC message views of consecutive OSC packets
+ * with the same ProcessMessages function and param are provided together and
+ * remain valid for the duration of the call.  Processing continues with the
+ * next OSC packet if an OSC packet contains an error.
+ *
+ * Example use:
+ * @code
+ * OscPacket * oscPackets[8];
+ * const unsigned int numberOfPackets = MyReceivePackets(oscPackets, 8);
+ * OscPacketBatchStatistics statistics;
+ * OscPacketProcessBatch(oscPackets, numberOfPackets, &statistics);
+ * @endcode
+ *
+ * @param oscPackets Array of OSC packets to be processed.
+ * @param numberOfPackets Number of OSC packets in the array.
+ * @param statistics Statistics of the batch.  May be NULL.
+ * @return Error code of the last OSC packet to contain an error (0 if
+ * successful).
+ */
+OscError OscPacketProcessBatch(OscPacket * const oscPackets[], const unsigned int numberOfPackets, OscPacketBatchStatistics * const statistics) {
+    OscPacketBatchStatistics batchStatistics;
+    batchStatistics.numberOfPackets = numberOfPackets;
+    batchStatistics.numberOfMessages = 0;
+    batchStatistics.numberOfErrors = 0;
+    batchStatistics.numberOfBytes = 0;
+    OscError lastError = OscErrorNone;
+    Deconstructor deconstructor;
+    deconstructor.numberOfMessages = 0;
+    ViewCollector viewCollector;
+    viewCollector.numberOfViews = 0;
+    viewCollector.processMessages = NULL;
+    viewCollector.param = NULL;
+    viewCollector.numberOfMessages = 0;
+    unsigned int packetIndex;
+    for (packetIndex = 0; packetIndex < numberOfPackets; packetIndex++) {
+        OscPacket * const oscPacket = oscPackets[packetIndex];
+
+        // Prefetch header and first OSC address pattern of next OSC packet
+        if ((packetIndex + 1) < numberOfPackets) {
+            OSC_PREFETCH(&oscPackets[packetIndex + 1]->size);
+            OSC_PREFETCH(oscPackets[packetIndex + 1]->contents);
+            OSC_PREFETCH(&oscPackets[packetIndex + 1]->contents[MIN_OSC_BUNDLE_SIZE]);
+        }
+        batchStatistics.numberOfBytes += oscPacket->size;
+
+        // Process OSC packet
+        OscError oscError;
+        if (oscPacket->processMessages != NULL) {
+            if ((oscPacket->processMessages != viewCollector.processMessages) || (oscPacket->param != viewCollector.param)) {
+                ProcessViews(&viewCollector);
+                viewCollector.processMessages = oscPacket->processMessages;
+                viewCollector.param = oscPacket->param;
+            }
+            oscError = CollectViews(&viewCollector, NULL, oscPacket->contents, oscPacket->size);
+        } else if (oscPacket->processMessage != NULL) {
+            oscError = DeconstructContents(oscPacket, &deconstructor, NULL, oscPacket->contents, oscPacket->size);
+        } else {
+            oscError = OscErrorCallbackFunctionUndefined; // error: user function undefined
+        }
+        if (oscError != OscErrorNone) {
+            batchStatistics.numberOfErrors++;
+            lastError = oscError;
+        }
+    }
+    ProcessViews(&viewCollector);
+    batchStatistics.numberOfMessages = deconstructor.numberOfMessages + viewCollector.numberOfMessages;
+    if (statistics != NULL) {
+        *statistics = batchStatistics;
+    }
+    return lastError;
 }
 
 /**
@@ -152,25 +319,35 @@ OscError OscPacketProcessMessages(OscPacket * const oscPacket) {
  * This is an internal function and cannot be called by the user application.
  *
  * @param oscPacket OSC packet.
+ * @param deconstructor Deconstruction state.
  * @param oscTimeTag OSC time tag of the bundle containing the OSC contents.
  * Must be NULL if the contents is not within an OSC bundle.
  * @param oscContents OSC contents to be deconstructed.
  * @param contentsSize Size of the OSC contents.
  * @return Error code (0 if successful).
  */
-static OscError DeconstructContents(OscPacket * const oscPacket, const OscTimeTag * const oscTimeTag, const void * const oscContents, const size_t contentsSize) {
+static OscError DeconstructContents(OscPacket * const oscPacket, Deconstructor * const deconstructor, const OscTimeTag * const oscTimeTag, const void * const oscContents, const size_t contentsSize) {
     if (contentsSize == 0) {
         return OscErrorContentsEmpty; // error: contents empty
     }
 
     // Contents is an OSC message
     if (OscContentsIsMessage(oscContents) == true) {
-        OscMessage oscMessage;
-        const OscError oscError = OscMessageInitialiseFromCharArray(&oscMessage, oscContents, contentsSize);
+        if ((oscPacket->oscTemplates != NULL) && (OscTemplatesProcessMessage(oscPacket->oscTemplates, oscTimeTag, oscContents, contentsSize) == true)) {
+            deconstructor->numberOfMessages++;
+            return OscErrorNone;
+        }
+        OscError oscError;
+        if (oscPacket->oscSignatureRegistry != NULL) {
+            oscError = OscMessageInitialiseFromCharArrayWithSignatures(&deconstructor->oscMessage, oscPacket->oscSignatureRegistry, oscContents, contentsSize);
+        } else {
+            oscError = OscMessageInitialiseFromCharArray(&deconstructor->oscMessage, oscContents, contentsSize);
+        }
         if (oscError != OscErrorNone) {
             return oscError; // error: message initialisation failed
         }
-        oscPacket->processMessage(oscPacket->param, oscTimeTag, &oscMessage);
+        deconstructor->numberOfMessages++;
+        oscPacket->processMessage(oscPacket->param, oscTimeTag, &deconstructor->oscMessage);
         return OscErrorNone;
     }
 
@@ -190,7 +367,7 @@ static OscError DeconstructContents(OscPacket * const oscPacket, const OscTimeTa
             if (oscError != OscErrorNone) {
                 return oscError; // error: get bundle element failed
             }
-            oscError = DeconstructContents(oscPacket, &oscBundle.oscTimeTag, oscBundleElement.contents, oscBundleElement.size.int32); // recursive deconstruction
+            oscError = DeconstructContents(oscPacket, deconstructor, &oscBundle.oscTimeTag, oscBundleElement.contents, oscBundleElement.size.int32); // recursive deconstruction
             if (oscError != OscErrorNone) {
                 return oscError; // error: contents deconstruction failed
             }
@@ -201,5 +378,159 @@ static OscError DeconstructContents(OscPacket * const oscPacket, const OscTimeTa
     return OscErrorInvalidContents; // error: invalid or uninitialised contents
 }
 
+/**
+ * @brief Recursively collects an OSC message view for each OSC message within
+ * the OSC contents.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param viewCollector OSC message view collector.
+ * @param oscTimeTag OSC time tag of the bundle containing the OSC contents.
+ * Must be NULL if the contents is not within an OSC bundle.
+ * @param oscContents OSC contents.
+ * @param contentsSize Size of the OSC contents.
+ * @return Error code (0 if successful).
+ */
+static OscError CollectViews(ViewCollector * const viewCollector, const OscTimeTag * const oscTimeTag, const char * const oscContents, const size_t contentsSize) {
+    if (contentsSize == 0) {
+        return OscErrorContentsEmpty; // error: contents empty
+    }
+
+    // Contents is an OSC message
+    if (OscContentsIsMessage(oscContents) == true) {
+        if (viewCollector->numberOfViews >= MAX_OSC_MESSAGE_VIEWS) {
+            ProcessViews(viewCollector);
+        }
+        OscMessageView * const oscMessageView = &viewCollector->oscMessageViews[viewCollector->numberOfViews];
+        const OscError oscError = InitialiseView(oscMessageView, oscContents, contentsSize);
+        if (oscError != OscErrorNone) {
+            return oscError; // error: invalid OSC message
+        }
+        oscMessageView->isInBundle = oscTimeTag != NULL;
+        oscMessageView->oscTimeTag = (oscTimeTag != NULL) ? *oscTimeTag : oscTimeTagZero;
+        viewCollector->numberOfViews++;
+        viewCollector->numberOfMessages++;
+        return OscErrorNone;
+    }
+
+    // Contents is an OSC bundle
+    if (OscContentsIsBundle(oscContents) == true) {
+        if (contentsSize < MIN_OSC_BUNDLE_SIZE) {
+            return OscErrorBundleSizeTooSmall; // error: too few bytes to contain bundle
+        }
+        if ((contentsSize % 4) != 0) {
+            return OscErrorSizeIsNotMultipleOfFour; // error: size not multiple of 4
+        }
+        size_t contentsIndex = sizeof (OSC_BUNDLE_HEADER);
+        OscTimeTag bundleTimeTag;
+        bundleTimeTag.byteStruct.byte7 = oscContents[contentsIndex++];
+        bundleTimeTag.byteStruct.byte6 = oscContents[contentsIndex++];
+        bundleTimeTag.byteStruct.byte5 = oscContents[contentsIndex++];
+        bundleTimeTag.byteStruct.byte4 = oscContents[contentsIndex++];
+        bundleTimeTag.byteStruct.byte3 = oscContents[contentsIndex++];
+        bundleTimeTag.byteStruct.byte2 = oscContents[contentsIndex++];
+        bundleTimeTag.byteStruct.byte1 = oscContents[contentsIndex++];
+        bundleTimeTag.byteStruct.byte0 = oscContents[contentsIndex++];
+        while (contentsIndex < contentsSize) {
+            if ((contentsIndex + sizeof (OscArgument32)) > contentsSize) {
+                return OscErrorBundleElementNotAvailable; // error: too few bytes to contain bundle element size
+            }
+            OscArgument32 elementSize;
+            elementSize.byteStruct.byte3 = oscContents[contentsIndex++];
+            elementSize.byteStruct.byte2 = oscContents[contentsIndex++];
+            elementSize.byteStruct.byte1 = oscContents[contentsIndex++];
+            elementSize.byteStruct.byte0 = oscContents[contentsIndex++];
+            if (elementSize.int32 < 0) {
+                return OscErrorNegativeBundleElementSize; // error: size cannot be negative
+            }
+            if ((elementSize.int32 % 4) != 0) {
+                return OscErrorSizeIsNotMultipleOfFour; // error: size not multiple of 4
+            }
+            if ((contentsIndex + elementSize.int32) > contentsSize) {
+                return OscErrorInvalidElementSize; // error: too few bytes for indicated size
+            }
+            const OscError oscError = CollectViews(viewCollector, &bundleTimeTag, &oscContents[contentsIndex], elementSize.int32); // recursive collection
+            if (oscError != OscErrorNone) {
+                return oscError; // error: contents collection failed
+            }
+            contentsIndex += elementSize.int32;
+        }
+        return OscErrorNone;
+    }
+
+    return OscErrorInvalidContents; // error: invalid or uninitialised contents
+}
+
+/**
+ * @brief Initialises an OSC message view from the OSC contents of an OSC
+ * message.  The OSC address pattern and OSC type tag string are validated but
+ * the arguments are not.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscMessageView OSC message view to be initialised.
+ * @param oscContents OSC contents of an OSC message.
+ * @param contentsSize Size of the OSC contents.
+ * @return Error code (0 if successful).
+ */
+static OscError InitialiseView(OscMessageView * const oscMessageView, const char * const oscContents, const size_t contentsSize) {
+    if (contentsSize < MIN_OSC_MESSAGE_SIZE) {
+        return OscErrorMessageSizeTooSmall; // error: size too small
+    }
+    if ((contentsSize % 4) != 0) {
+        return OscErrorSizeIsNotMultipleOfFour; // error: size not multiple of 4
+    }
+
+    // OSC address pattern
+    const char * const addressEnd = memchr(oscContents, '\0', contentsSize);
+    if (addressEnd == NULL) {
+        return OscErrorSourceEndsBeforeEndOfAddressPattern; // error: address pattern not terminated
+    }
+    size_t contentsIndex = ((addressEnd - oscContents) + 4) & ~((size_t) 3);
+    if ((contentsIndex >= contentsSize) || (oscContents[contentsIndex] != ',')) {
+        return OscErrorSourceEndsBeforeStartOfTypeTagString; // error: type tag string not found
+    }
+
+    // OSC type tag string
+    const char * const typeTagEnd = memchr(&oscContents[contentsIndex], '\0', contentsSize - contentsIndex);
+    if (typeTagEnd == NULL) {
+        return OscErrorSourceEndsBeforeEndOfTypeTagString; // error: type tag string not terminated
+    }
+    contentsIndex = ((typeTagEnd - oscContents) + 4) & ~((size_t) 3);
+
+    oscMessageView->contents = oscContents;
+    oscMessageView->size = contentsSize;
+    oscMessageView->argumentsOffset = contentsIndex;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Determines the run length of each collected OSC message view and
+ * provides the OSC message views to the ProcessMessages function.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param viewCollector OSC message view collector.
+ */
+static void ProcessViews(ViewCollector * const viewCollector) {
+    if (viewCollector->numberOfViews == 0) {
+        return;
+    }
+    OscMessageView * const oscMessageViews = viewCollector->oscMessageViews;
+    unsigned int viewIndex = viewCollector->numberOfViews - 1;
+    oscMessageViews[viewIndex].runLength = 1;
+    while (viewIndex-- > 0) {
+        const OscMessageView * const next = &oscMessageViews[viewIndex + 1];
+        OscMessageView * const current = &oscMessageViews[viewIndex];
+        if ((current->argumentsOffset == next->argumentsOffset) && (memcmp(current->contents, next->contents, current->argumentsOffset) == 0)) {
+            current->runLength = next->runLength + 1;
+        } else {
+            current->runLength = 1;
+        }
+    }
+    viewCollector->processMessages(viewCollector->param, oscMessageViews, viewCollector->numberOfViews);
+    viewCollector->numberOfViews = 0;
+}
+
 //------------------------------------------------------------------------------
 // End of file
@@ -16,6 +16,8 @@
 #include "OscCommon.h"
 #include "OscError.h"
 #include "OscMessage.h"
+#include "OscTemplate.h"
+#include <stdbool.h>
 #include <stddef.h>
 
 //------------------------------------------------------------------------------
@@ -27,6 +29,37 @@
  */
 #define MAX_OSC_PACKET_SIZE (MAX_TRANSPORT_SIZE)
 
+/**
+ * @brief Maximum number of OSC message views provided to the ProcessMessages
+ * function by each call.  This value may be modified as required by the user
+ * application.
+ */
+#define MAX_OSC_MESSAGE_VIEWS (16)
+
+/**
+ * @brief OSC message view.  Describes an OSC message within the contents of an
+ * OSC packet without copying it.  The OSC message may be deconstructed by
+ * calling OscMessageInitialiseFromCharArray with the contents and size.
+ */
+typedef struct {
+    const char * contents; // OSC message within the contents of the OSC packet
+    size_t size;
+    size_t argumentsOffset; // combined size of the OSC address pattern and OSC type tag string
+    OscTimeTag oscTimeTag; // OSC time tag of the bundle containing the OSC message
+    bool isInBundle; // false if the OSC message is not within a bundle and oscTimeTag is undefined
+    unsigned int runLength; // number of consecutive views, starting with this one, with an identical OSC address pattern and OSC type tag string
+} OscMessageView;
+
+/**
+ * @brief OSC packet batch statistics.
+ */
+typedef struct {
+    unsigned int numberOfPackets;
+    unsigned int numberOfMessages;
+    unsigned int numberOfErrors; // number of OSC packets containing an error
+    size_t numberOfBytes;
+} OscPacketBatchStatistics;
+
 /**
  * @brief OSC packet structure.  Structure members are used internally and
  * should not be used by the user application.
@@ -35,6 +68,9 @@ typedef struct {
     char contents[MAX_OSC_PACKET_SIZE];
     size_t size;
     void ( *processMessage)(void* param, const OscTimeTag * const oscTimeTag, OscMessage * const oscMessage);
+    void ( *processMessages)(void* param, const OscMessageView * const oscMessageViews, const unsigned int numberOfViews);
+    const OscSignatureRegistry * oscSignatureRegistry; // optional
+    OscTemplates * oscTemplates; // optional
     void* param;
 } OscPacket;
 
@@ -45,6 +81,8 @@ void OscPacketInitialise(OscPacket * const oscPacket);
 OscError OscPacketInitialiseFromContents(OscPacket * const oscPacket, const void * const oscContents);
 OscError OscPacketInitialiseFromCharArray(OscPacket * const oscPacket, const char * const source, const size_t numberOfBytes);
 OscError OscPacketProcessMessages(OscPacket * const oscPacket);
+OscError OscPacketProcessMessageViews(OscPacket * const oscPacket);
+OscError OscPacketProcessBatch(OscPacket * const oscPackets[], const unsigned int numberOfPackets, OscPacketBatchStatistics * const statistics);
 
 #endif
 
@@ -0,0 +1,231 @@
+/**
+ * @file OscPacketPool.c
+ * @author Seb Madgwick
+ * @brief Functions and structures for a pool of reference-counted OSC packets
+ * that may be shared read-only by multiple consumers without being copied.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscPacketPool.h"
+#ifdef _MSC_VER
+#include <windows.h> // InterlockedCompareExchange
+#endif
+
+//------------------------------------------------------------------------------
+// Definitions
+
+#ifndef OSC_ATOMIC_COMPARE_AND_SWAP
+#error "OSC_ATOMIC_COMPARE_AND_SWAP must be defined in OscCommon.h for this compiler"
+#endif
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static unsigned int FindBufferIndex(const OscPacketPool * const oscPacketPool, const OscPacket * const oscPacket);
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Initialises an OSC packet pool structure.
+ *
+ * An OSC packet pool structure must be initialised before use.  An OSC packet
+ * acquired from the pool is written by the producer and may then be shared
+ * read-only with any number of consumers.  Each consumer that keeps the OSC
+ * packet beyond the call in which it was provided must retain the OSC packet
+ * and release it when finished.  Message views provided by
+ * OscPacketProcessMessageViews point into the OSC packet and so remain valid
+ * while the OSC packet is retained.  The OSC packet is returned to the pool
+ * when the last reference is released.  Reference counts are updated
+ * atomically so that OSC packets may be released from any thread or
+ * interrupt.
+ *
+ * Example use:
+ * @code
+ * OscPacketPool oscPacketPool;
+ * OscPacketPoolInitialise(&oscPacketPool);
+ * @endcode
+ *
+ * @param oscPacketPool OSC packet pool structure to be initialised.
+ */
+void OscPacketPoolInitialise(OscPacketPool * const oscPacketPool) {
+    unsigned int bufferIndex;
+    for (bufferIndex = 0; bufferIndex < MAX_OSC_PACKET_POOL_SIZE; bufferIndex++) {
+        oscPacketPool->buffers[bufferIndex].referenceCount = 0;
+    }
+}
+
+/**
+ * @brief Acquires an OSC packet from the OSC packet pool.
+ *
+ * The acquired OSC packet is initialised and has a reference count of 1.  The
+ * OSC packet must be released by the producer once it has been provided to
+ * each consumer.
+ *
+ * Example use:
+ * @code
+ * OscPacket * oscPacket;
+ * if(OscPacketPoolAcquire(&oscPacketPool, &oscPacket) == OscErrorNone) {
+ *     oscPacket->size = MyReceive(oscPacket->contents, sizeof(oscPacket->contents));
+ *     MyLoggerQueue(oscPacket); // logger retains OSC packet
+ *     MyRouterQueue(oscPacket); // router retains OSC packet
+ *     OscPacketPoolRelease(&oscPacketPool, oscPacket);
+ * }
+ * @endcode
+ *
+ * @param oscPacketPool OSC packet pool structure.
+ * @param oscPacket Address of the acquired OSC packet.
+ * @return Error code (0 if successful).
+ */
+OscError OscPacketPoolAcquire(OscPacketPool * const oscPacketPool, OscPacket * * const oscPacket) {
+    unsigned int bufferIndex;
+    for (bufferIndex = 0; bufferIndex < MAX_OSC_PACKET_POOL_SIZE; bufferIndex++) {
+        OscPacketPoolBuffer * const buffer = &oscPacketPool->buffers[bufferIndex];
+        if (buffer->referenceCount != 0) {
+            continue;
+        }
+        if (OSC_ATOMIC_COMPARE_AND_SWAP(buffer->referenceCount, 0, 1) == false) {
+            continue; // buffer acquired by another thread or interrupt
+        }
+        OscPacketInitialise(&buffer->oscPacket);
+        *oscPacket = &buffer->oscPacket;
+        return OscErrorNone;
+    }
+    return OscErrorPacketPoolEmpty; // error: no OSC packets available
+}
+
+/**
+ * @brief Adds a reference to an OSC packet acquired from an OSC packet pool.
+ *
+ * Example use:
+ * @code
+ * void MyLoggerQueue(const OscPacket * const oscPacket) {
+ *     if(OscPacketPoolRetain(&oscPacketPool, oscPacket) == OscErrorNone) {
+ *         myLoggerQueue[myLoggerQueueIndex++] = oscPacket;
+ *     }
+ * }
+ * @endcode
+ *
+ * @param oscPacketPool OSC packet pool structure.
+ * @param oscPacket OSC packet acquired from the OSC packet pool.
+ * @return Error code (0 if successful).
+ */
+OscError OscPacketPoolRetain(OscPacketPool * const oscPacketPool, const OscPacket * const oscPacket) {
+    const unsigned int bufferIndex = FindBufferIndex(oscPacketPool, oscPacket);
+    if (bufferIndex >= MAX_OSC_PACKET_POOL_SIZE) {
+        return OscErrorPacketNotFromPool; // error: OSC packet not within pool
+    }
+    OscPacketPoolBuffer * const buffer = &oscPacketPool->buffers[bufferIndex];
+    unsigned int referenceCount;
+    do {
+        referenceCount = buffer->referenceCount;
+        if (referenceCount == 0) {
+            return OscErrorPacketNotAcquired; // error: OSC packet already returned to pool
+        }
+    } while (OSC_ATOMIC_COMPARE_AND_SWAP(buffer->referenceCount, referenceCount, referenceCount + 1) == false);
+    return OscErrorNone;
+}
+
+/**
+ * @brief Removes a reference to an OSC packet acquired from an OSC packet
+ * pool.  The OSC packet is returned to the OSC packet pool when the last
+ * reference is removed and must not be used after it has been released.
+ *
+ * Example use:
+ * @code
+ * MyLog(oscPacket);
+ * OscPacketPoolRelease(&oscPacketPool, oscPacket);
+ * @endcode
+ *
+ * @param oscPacketPool OSC packet pool structure.
+ * @param oscPacket OSC packet acquired from the OSC packet pool.
+ * @return Error code (0 if successful).
+ */
+OscError OscPacketPoolRelease(OscPacketPool * const oscPacketPool, const OscPacket * const oscPacket) {
+    const unsigned int bufferIndex = FindBufferIndex(oscPacketPool, oscPacket);
+    if (bufferIndex >= MAX_OSC_PACKET_POOL_SIZE) {
+        return OscErrorPacketNotFromPool; // error: OSC packet not within pool
+    }
+    OscPacketPoolBuffer * const buffer = &oscPacketPool->buffers[bufferIndex];
+    unsigned int referenceCount;
+    do {
+        referenceCount = buffer->referenceCount;
+        if (referenceCount == 0) {
+            return OscErrorPacketNotAcquired; // error: OSC packet already returned to pool
+        }
+    } while (OSC_ATOMIC_COMPARE_AND_SWAP(buffer->referenceCount, referenceCount, referenceCount - 1) == false);
+    return OscErrorNone;
+}
+
+/**
+ * @brief Returns the number of references to an OSC packet acquired from an
+ * OSC packet pool.
+ *
+ * Example use:
+ * @code
+ * printf("%u references", OscPacketPoolGetReferenceCount(&oscPacketPool, oscPacket));
+ * @endcode
+ *
+ * @param oscPacketPool OSC packet pool structure.
+ * @param oscPacket OSC packet acquired from the OSC packet pool.
+ * @return Number of references.  0 if the OSC packet is not within the OSC
+ * packet pool.
+ */
+unsigned int OscPacketPoolGetReferenceCount(const OscPacketPool * const oscPacketPool, const OscPacket * const oscPacket) {
+    const unsigned int bufferIndex = FindBufferIndex(oscPacketPool, oscPacket);
+    if (bufferIndex >= MAX_OSC_PACKET_POOL_SIZE) {
+        return 0;
+    }
+    return oscPacketPool->buffers[bufferIndex].referenceCount;
+}
+
+/**
+ * @brief Returns the number of OSC packets available within an OSC packet
+ * pool.
+ *
+ * Example use:
+ * @code
+ * if(OscPacketPoolGetNumberAvailable(&oscPacketPool) == 0) {
+ *     printf("OSC packet pool exhausted");
+ * }
+ * @endcode
+ *
+ * @param oscPacketPool OSC packet pool structure.
+ * @return Number of OSC packets available.
+ */
+unsigned int OscPacketPoolGetNumberAvailable(const OscPacketPool * const oscPacketPool) {
+    unsigned int numberAvailable = 0;
+    unsigned int bufferIndex;
+    for (bufferIndex = 0; bufferIndex < MAX_OSC_PACKET_POOL_SIZE; bufferIndex++) {
+        if (oscPacketPool->buffers[bufferIndex].referenceCount == 0) {
+            numberAvailable++;
+        }
+    }
+    return numberAvailable;
+}
+
+/**
+ * @brief Returns the index of the buffer containing an OSC packet.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscPacketPool OSC packet pool structure.
+ * @param oscPacket OSC packet.
+ * @return Index of the buffer.  MAX_OSC_PACKET_POOL_SIZE if the OSC packet is
+ * not within the OSC packet pool.
+ */
+static unsigned int FindBufferIndex(const OscPacketPool * const oscPacketPool, const OscPacket * const oscPacket) {
+    unsigned int bufferIndex;
+    for (bufferIndex = 0; bufferIndex < MAX_OSC_PACKET_POOL_SIZE; bufferIndex++) {
+        if (&oscPacketPool->buffers[bufferIndex].oscPacket == oscPacket) {
+            break;
+        }
+    }
+    return bufferIndex;
+}
+
+//------------------------------------------------------------------------------
+// End of file
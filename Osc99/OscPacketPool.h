@@ -0,0 +1,62 @@
+/**
+ * @file OscPacketPool.h
+ * @author Seb Madgwick
+ * @brief Functions and structures for a pool of reference-counted OSC packets
+ * that may be shared read-only by multiple consumers without being copied.
+ *
+ * MAX_OSC_PACKET_POOL_SIZE may be modified as required by the user
+ * application.
+ *
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_PACKET_POOL_H
+#define OSC_PACKET_POOL_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscPacket.h"
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Number of OSC packets within an OSC packet pool.  This value may be
+ * modified as required by the user application.
+ */
+#define MAX_OSC_PACKET_POOL_SIZE (8)
+
+/**
+ * @brief OSC packet pool buffer structure.  Structure members are used
+ * internally and should not be used by the user application.
+ */
+typedef struct {
+    OscPacket oscPacket;
+    volatile unsigned int referenceCount; // 0 if available
+} OscPacketPoolBuffer;
+
+/**
+ * @brief OSC packet pool structure.  Structure members are used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    OscPacketPoolBuffer buffers[MAX_OSC_PACKET_POOL_SIZE];
+} OscPacketPool;
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+void OscPacketPoolInitialise(OscPacketPool * const oscPacketPool);
+OscError OscPacketPoolAcquire(OscPacketPool * const oscPacketPool, OscPacket * * const oscPacket);
+OscError OscPacketPoolRetain(OscPacketPool * const oscPacketPool, const OscPacket * const oscPacket);
+OscError OscPacketPoolRelease(OscPacketPool * const oscPacketPool, const OscPacket * const oscPacket);
+unsigned int OscPacketPoolGetReferenceCount(const OscPacketPool * const oscPacketPool, const OscPacket * const oscPacket);
+unsigned int OscPacketPoolGetNumberAvailable(const OscPacketPool * const oscPacketPool);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
@@ -9,6 +9,7 @@
 //------------------------------------------------------------------------------
 // Includes
 
+#include "OscBundle.h"
 #include "OscSlip.h"
 #include <stddef.h>
 
@@ -24,6 +25,13 @@
 #define SLIP_ESC_END ((char)0xDC)
 #define SLIP_ESC_ESC ((char)0xDD)
 
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static OscError EncodePacket(const OscPacket * const oscPacket, size_t * const slipPacketSize, char * const destination, const size_t destinationSize);
+static OscError ProcessEnd(OscSlipDecoder * const oscSlipDecoder);
+static OscError ProcessBundleElement(OscSlipDecoder * const oscSlipDecoder);
+
 //------------------------------------------------------------------------------
 // Functions
 
@@ -49,27 +57,49 @@
  */
 OscError OscSlipEncodePacket(const OscPacket * const oscPacket, size_t * const slipPacketSize, char * const destination, const size_t destinationSize) {
     *slipPacketSize = 0; // size will be 0 if function unsuccessful
-    unsigned int encodedPacketSize = 0;
+    return EncodePacket(oscPacket, slipPacketSize, destination, destinationSize);
+}
+
+/**
+ * @brief Encodes multiple OSC packets as consecutive SLIP packets.
+ *
+ * Each OSC packet is encoded as a SLIP packet and written to the destination
+ * address immediately after the previous SLIP packet so that the SLIP END
+ * byte that terminates each SLIP packet also delimits the next.  This allows
+ * the application to send multiple OSC packets with a single write or DMA
+ * transfer.  The combined size of the encoded SLIP packets is written to the
+ * slipPacketsSize address.  If the destination is too small to contain all of
+ * the encoded SLIP packets then the written size will be 0.
+ *
+ * Example use:
+ * @code
+ * const OscPacket * const oscPackets[] = { &oscPacket1, &oscPacket2 };
+ * char slipPackets[2048];
+ * size_t slipPacketsSize;
+ * OscSlipEncodePackets(oscPackets, 2, &slipPacketsSize, slipPackets, sizeof(slipPackets));
+ * MySerialWrite(slipPackets, slipPacketsSize);
+ * @endcode
+ *
+ * @param oscPackets Array of OSC packets to be encoded.
+ * @param numberOfPackets Number of OSC packets in the array.
+ * @param slipPacketsSize Combined size of the encoded SLIP packets.
+ * @param destination Destination address of the SLIP packets.
+ * @param destinationSize Size of the destination.
+ * @return Error code (0 if successful).
+ */
+OscError OscSlipEncodePackets(const OscPacket * const oscPackets[], const unsigned int numberOfPackets, size_t * const slipPacketsSize, char * const destination, const size_t destinationSize) {
+    *slipPacketsSize = 0; // size will be 0 if function unsuccessful
+    size_t encodedPacketsSize = 0;
     unsigned int packetIndex;
-    for (packetIndex = 0; packetIndex < oscPacket->size; packetIndex++) {
-        if ((encodedPacketSize + 1) > destinationSize) {
-            return OscErrorDestinationTooSmall; // error: destination too small
-        }
-        switch (oscPacket->contents[packetIndex]) {
-            case SLIP_END:
-                destination[encodedPacketSize++] = SLIP_ESC;
-                destination[encodedPacketSize++] = SLIP_ESC_END;
-                break;
-            case SLIP_ESC:
-                destination[encodedPacketSize++] = SLIP_ESC;
-                destination[encodedPacketSize++] = SLIP_ESC_ESC;
-                break;
-            default:
-                destination[encodedPacketSize++] = oscPacket->contents[packetIndex];
+    for (packetIndex = 0; packetIndex < numberOfPackets; packetIndex++) {
+        size_t encodedPacketSize;
+        const OscError oscError = EncodePacket(oscPackets[packetIndex], &encodedPacketSize, &destination[encodedPacketsSize], destinationSize - encodedPacketsSize);
+        if (oscError != OscErrorNone) {
+            return oscError;
         }
+        encodedPacketsSize += encodedPacketSize;
     }
-    destination[encodedPacketSize++] = SLIP_END;
-    *slipPacketSize = encodedPacketSize;
+    *slipPacketsSize = encodedPacketsSize;
     return OscErrorNone;
 }
 
@@ -79,6 +109,8 @@ OscError OscSlipEncodePacket(const OscPacket * const oscPacket, size_t * const s
  * An OSC SLIP decoder structure must be initialised before use.  A
  * ProcessPacket function must be implemented within the application and
  * assigned to the OSC SLIP decoder structure after initialisation.
+ * Alternatively, a ProcessMessage function may be assigned instead to enable
+ * cut-through processing as described for OscSlipDecoderProcessByte.
  *
  * Example use:
  * @code
@@ -95,8 +127,10 @@ OscError OscSlipEncodePacket(const OscPacket * const oscPacket, size_t * const s
  * @param oscSlipDecoder Address OSC SLIP decoder structure.
  */
 void OscSlipDecoderInitialise(OscSlipDecoder * const oscSlipDecoder) {
-    oscSlipDecoder->bufferIndex = 0;
+    OscPacketInitialise(&oscSlipDecoder->oscPacket);
+    OscSlipDecoderClearBuffer(oscSlipDecoder);
     oscSlipDecoder->processPacket = NULL;
+    oscSlipDecoder->processMessage = NULL;
     oscSlipDecoder->param = NULL;
 }
 
@@ -104,11 +138,22 @@ void OscSlipDecoderInitialise(OscSlipDecoder * const oscSlipDecoder) {
  * @brief Processes byte received within serial stream.
  *
  * This function should be called for each consecutive byte received within a
- * serial stream.  Each byte is added to SLIP decoder receive buffer.  If the
- * received byte is the last byte of a SLIP packet then the SLIP packet is
- * decoded and parsed to the application as an OSC packet via the ProcessPacket
- * function.  The decoded packet will be discarded if a ProcessPacket function
- * has not been assigned.
+ * serial stream.  Each byte is decoded as it is received.  If the received
+ * byte is the last byte of a SLIP packet then the decoded OSC packet is
+ * provided to the application via the ProcessPacket function.  A corrupt SLIP
+ * packet is reported by the error returned for the byte at which the
+ * corruption is detected and all remaining bytes of the SLIP packet are
+ * discarded.
+ *
+ * Cut-through processing is enabled if a ProcessMessage function is assigned.
+ * Each OSC message within an OSC bundle is then provided to the ProcessMessage
+ * function as soon as the bytes of its bundle element have been received,
+ * rather than after the entire SLIP packet has been received.  An OSC packet
+ * containing a single OSC message is provided when the SLIP packet ends.  The
+ * ProcessPacket function is not used.  OSC messages that have already been
+ * provided cannot be withdrawn if the remainder of the SLIP packet is found to
+ * be corrupt, in which case the error returned indicates that the OSC bundle
+ * was incomplete.
  *
  * Example use:
  * @code
@@ -123,54 +168,51 @@ void OscSlipDecoderInitialise(OscSlipDecoder * const oscSlipDecoder) {
  */
 OscError OscSlipDecoderProcessByte(OscSlipDecoder * const oscSlipDecoder, const char byte) {
 
-    // Add byte to buffer
-    oscSlipDecoder->buffer[oscSlipDecoder->bufferIndex] = byte;
-
-    // Increment index with overflow
-    if (++oscSlipDecoder->bufferIndex >= OSC_SLIP_DECODER_BUFFER_SIZE) {
-        oscSlipDecoder->bufferIndex = 0;
-        return OscErrorEncodedSlipPacketTooLong; // error: SLIP packet is too long
+    // Process end of SLIP packet
+    if (byte == SLIP_END) {
+        return ProcessEnd(oscSlipDecoder);
     }
-
-    // Return if byte not END byte
-    if (byte != SLIP_END) {
+    if (oscSlipDecoder->isDiscarding == true) {
         return OscErrorNone;
     }
 
-    // Reset index
-    oscSlipDecoder->bufferIndex = 0;
-
-    // Decode packet
-    OscPacket oscPacket;
-    OscPacketInitialise(&oscPacket);
-    unsigned int index = 0;
-    while (oscSlipDecoder->buffer[index] != SLIP_END) {
-        if (oscSlipDecoder->buffer[index] == SLIP_ESC) {
-            switch (oscSlipDecoder->buffer[++index]) {
-                case SLIP_ESC_END:
-                    oscPacket.contents[oscPacket.size++] = SLIP_END;
-                    break;
-                case SLIP_ESC_ESC:
-                    oscPacket.contents[oscPacket.size++] = SLIP_ESC;
-                    break;
-                default:
-                    return OscErrorUnexpectedByteAfterSlipEsc; // error: unexpected byte value
-            }
-        } else {
-            oscPacket.contents[oscPacket.size++] = oscSlipDecoder->buffer[index];
-        }
-        if (oscPacket.size > MAX_OSC_PACKET_SIZE) {
-            return OscErrorDecodedSlipPacketTooLong; // error: decoded packet too large
+    // Decode byte
+    char decodedByte = byte;
+    if (oscSlipDecoder->isEscaped == true) {
+        oscSlipDecoder->isEscaped = false;
+        switch (byte) {
+            case SLIP_ESC_END:
+                decodedByte = SLIP_END;
+                break;
+            case SLIP_ESC_ESC:
+                decodedByte = SLIP_ESC;
+                break;
+            default:
+                oscSlipDecoder->isDiscarding = true;
+                return OscErrorUnexpectedByteAfterSlipEsc; // error: unexpected byte value
         }
-        index++;
+    } else if (byte == SLIP_ESC) {
+        oscSlipDecoder->isEscaped = true;
+        return OscErrorNone;
     }
 
-    // Call user function
-    if (oscSlipDecoder->processPacket == NULL) {
-        return OscErrorCallbackFunctionUndefined; // error: user function undefined
+    // Add decoded byte to OSC packet
+    OscPacket * const oscPacket = &oscSlipDecoder->oscPacket;
+    if (oscPacket->size >= MAX_OSC_PACKET_SIZE) {
+        oscSlipDecoder->isDiscarding = true;
+        return OscErrorDecodedSlipPacketTooLong; // error: decoded packet too large
     }
-    oscSlipDecoder->processPacket(oscSlipDecoder->param, &oscPacket);
-    return OscErrorNone;
+    oscPacket->contents[oscPacket->size++] = decodedByte;
+
+    // Cut-through processing
+    if (oscSlipDecoder->processMessage == NULL) {
+        return OscErrorNone;
+    }
+    const OscError oscError = ProcessBundleElement(oscSlipDecoder);
+    if (oscError != OscErrorNone) {
+        oscSlipDecoder->isDiscarding = true;
+    }
+    return oscError;
 }
 
 /**
@@ -184,7 +226,191 @@ OscError OscSlipDecoderProcessByte(OscSlipDecoder * const oscSlipDecoder, const
  * @param oscSlipDecoder Address OSC SLIP decoder structure.
  */
 void OscSlipDecoderClearBuffer(OscSlipDecoder * const oscSlipDecoder) {
-    oscSlipDecoder->bufferIndex = 0;
+    oscSlipDecoder->oscPacket.size = 0;
+    oscSlipDecoder->isEscaped = false;
+    oscSlipDecoder->isDiscarding = false;
+    oscSlipDecoder->bundleElementIndex = MIN_OSC_BUNDLE_SIZE;
+}
+
+/**
+ * @brief Encodes an OSC packet as a SLIP packet.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscPacket OSC packet to be encoded.
+ * @param slipPacketSize Size of the encoded SLIP packet.  Not written if the
+ * function is unsuccessful.
+ * @param destination Destination address of the OSC SLIP packet.
+ * @param destinationSize Size of the destination.
+ * @return Error code (0 if successful).
+ */
+static OscError EncodePacket(const OscPacket * const oscPacket, size_t * const slipPacketSize, char * const destination, const size_t destinationSize) {
+    size_t encodedPacketSize = 0;
+    unsigned int packetIndex;
+    for (packetIndex = 0; packetIndex < oscPacket->size; packetIndex++) {
+        if ((encodedPacketSize + 2) > destinationSize) {
+            return OscErrorDestinationTooSmall; // error: destination too small for escaped byte and END
+        }
+        switch (oscPacket->contents[packetIndex]) {
+            case SLIP_END:
+                destination[encodedPacketSize++] = SLIP_ESC;
+                destination[encodedPacketSize++] = SLIP_ESC_END;
+                break;
+            case SLIP_ESC:
+                destination[encodedPacketSize++] = SLIP_ESC;
+                destination[encodedPacketSize++] = SLIP_ESC_ESC;
+                break;
+            default:
+                destination[encodedPacketSize++] = oscPacket->contents[packetIndex];
+        }
+    }
+    if ((encodedPacketSize + 1) > destinationSize) {
+        return OscErrorDestinationTooSmall; // error: destination too small
+    }
+    destination[encodedPacketSize++] = SLIP_END;
+    *slipPacketSize = encodedPacketSize;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Processes the end of a SLIP packet.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscSlipDecoder Address OSC SLIP decoder structure.
+ * @return Error code (0 if successful).
+ */
+static OscError ProcessEnd(OscSlipDecoder * const oscSlipDecoder) {
+    OscPacket * const oscPacket = &oscSlipDecoder->oscPacket;
+    const bool isDiscarding = oscSlipDecoder->isDiscarding;
+    const bool isEscaped = oscSlipDecoder->isEscaped;
+    const size_t size = oscPacket->size;
+    const unsigned int bundleElementIndex = oscSlipDecoder->bundleElementIndex;
+    OscSlipDecoderClearBuffer(oscSlipDecoder);
+    if (isDiscarding == true) {
+        return OscErrorNone; // error already reported
+    }
+    if (isEscaped == true) {
+        return OscErrorUnexpectedByteAfterSlipEsc; // error: SLIP packet ends after SLIP_ESC
+    }
+
+    // Call user function
+    if (oscSlipDecoder->processMessage == NULL) {
+        if (oscSlipDecoder->processPacket == NULL) {
+            return OscErrorCallbackFunctionUndefined; // error: user function undefined
+        }
+        oscPacket->size = size;
+        oscSlipDecoder->processPacket(oscSlipDecoder->param, oscPacket);
+        oscPacket->size = 0;
+        return OscErrorNone;
+    }
+
+    // Cut-through processing
+    if (size == 0) {
+        return OscErrorNone; // ignore empty SLIP packet
+    }
+    if (OscContentsIsMessage(oscPacket->contents) == true) {
+        OscMessage oscMessage;
+        const OscError oscError = OscMessageInitialiseFromCharArray(&oscMessage, oscPacket->contents, size);
+        if (oscError != OscErrorNone) {
+            return oscError; // error: message initialisation failed
+        }
+        oscSlipDecoder->processMessage(oscSlipDecoder->param, NULL, &oscMessage);
+        return OscErrorNone;
+    }
+    if (OscContentsIsBundle(oscPacket->contents) == false) {
+        return OscErrorInvalidContents; // error: invalid contents
+    }
+    if (size < MIN_OSC_BUNDLE_SIZE) {
+        return OscErrorBundleSizeTooSmall; // error: too few bytes to contain bundle
+    }
+    if (bundleElementIndex != size) {
+        return OscErrorInvalidElementSize; // error: last bundle element incomplete
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Provides each OSC message within a bundle element to the
+ * ProcessMessage function once all bytes of the bundle element have been
+ * received.  This function must be called after each decoded byte.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscSlipDecoder Address OSC SLIP decoder structure.
+ * @return Error code (0 if successful).
+ */
+static OscError ProcessBundleElement(OscSlipDecoder * const oscSlipDecoder) {
+    const OscPacket * const oscPacket = &oscSlipDecoder->oscPacket;
+    if (OscContentsIsBundle(oscPacket->contents) == false) {
+        return OscErrorNone; // OSC message processed at end of SLIP packet
+    }
+    if (oscPacket->size < MIN_OSC_BUNDLE_SIZE) {
+        return OscErrorNone; // bundle header incomplete
+    }
+
+    // Validate bundle header and get OSC time tag
+    if (oscPacket->size == MIN_OSC_BUNDLE_SIZE) {
+        unsigned int sourceIndex;
+        for (sourceIndex = 0; sourceIndex < sizeof (OSC_BUNDLE_HEADER); sourceIndex++) {
+            if (oscPacket->contents[sourceIndex] != OSC_BUNDLE_HEADER[sourceIndex]) {
+                return OscErrorNoHashAtStartOfBundle; // error: invalid bundle header
+            }
+        }
+        oscSlipDecoder->oscTimeTag.byteStruct.byte7 = oscPacket->contents[sourceIndex++];
+        oscSlipDecoder->oscTimeTag.byteStruct.byte6 = oscPacket->contents[sourceIndex++];
+        oscSlipDecoder->oscTimeTag.byteStruct.byte5 = oscPacket->contents[sourceIndex++];
+        oscSlipDecoder->oscTimeTag.byteStruct.byte4 = oscPacket->contents[sourceIndex++];
+        oscSlipDecoder->oscTimeTag.byteStruct.byte3 = oscPacket->contents[sourceIndex++];
+        oscSlipDecoder->oscTimeTag.byteStruct.byte2 = oscPacket->contents[sourceIndex++];
+        oscSlipDecoder->oscTimeTag.byteStruct.byte1 = oscPacket->contents[sourceIndex++];
+        oscSlipDecoder->oscTimeTag.byteStruct.byte0 = oscPacket->contents[sourceIndex++];
+        return OscErrorNone;
+    }
+
+    // Get bundle element size
+    unsigned int sourceIndex = oscSlipDecoder->bundleElementIndex;
+    if (oscPacket->size < (sourceIndex + sizeof (OscArgument32))) {
+        return OscErrorNone; // bundle element size incomplete
+    }
+    OscArgument32 elementSize;
+    elementSize.byteStruct.byte3 = oscPacket->contents[sourceIndex++];
+    elementSize.byteStruct.byte2 = oscPacket->contents[sourceIndex++];
+    elementSize.byteStruct.byte1 = oscPacket->contents[sourceIndex++];
+    elementSize.byteStruct.byte0 = oscPacket->contents[sourceIndex++];
+    if (elementSize.int32 < 0) {
+        return OscErrorNegativeBundleElementSize; // error: size cannot be negative
+    }
+    if ((elementSize.int32 % 4) != 0) {
+        return OscErrorSizeIsNotMultipleOfFour; // error: size not multiple of 4
+    }
+    if (oscPacket->size < (sourceIndex + elementSize.int32)) {
+        return OscErrorNone; // bundle element incomplete
+    }
+    oscSlipDecoder->bundleElementIndex = sourceIndex + elementSize.int32;
+
+    // Process bundle element
+    const char * const contents = &oscPacket->contents[sourceIndex];
+    if (elementSize.int32 == 0) {
+        return OscErrorContentsEmpty; // error: contents empty
+    }
+    if (OscContentsIsMessage(contents) == true) {
+        OscMessage oscMessage;
+        const OscError oscError = OscMessageInitialiseFromCharArray(&oscMessage, contents, elementSize.int32);
+        if (oscError != OscErrorNone) {
+            return oscError; // error: message initialisation failed
+        }
+        oscSlipDecoder->processMessage(oscSlipDecoder->param, &oscSlipDecoder->oscTimeTag, &oscMessage);
+        return OscErrorNone;
+    }
+    if (OscContentsIsBundle(contents) == true) {
+        OscPacket oscPacketElement;
+        OscPacketInitialiseFromCharArray(&oscPacketElement, contents, elementSize.int32);
+        oscPacketElement.processMessage = oscSlipDecoder->processMessage;
+        oscPacketElement.param = oscSlipDecoder->param;
+        return OscPacketProcessMessages(&oscPacketElement);
+    }
+    return OscErrorInvalidContents; // error: invalid contents
 }
 
 //------------------------------------------------------------------------------
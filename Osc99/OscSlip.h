@@ -15,24 +15,23 @@
 #include "OscCommon.h"
 #include "OscError.h"
 #include "OscPacket.h"
+#include <stdbool.h>
 
 //------------------------------------------------------------------------------
 // Definitions
 
-/**
- * @brief OSC SLIP decoder buffer size.  If a packet size exceeds the buffer
- * size then all bytes in the decoder buffer will be discarded.
- */
-#define OSC_SLIP_DECODER_BUFFER_SIZE (MAX_TRANSPORT_SIZE)
-
 /**
  * @brief OSC SLIP decoder structure.  Structure members are used internally and
  * should not be used by the user application.
  */
 typedef struct {
-    char buffer[OSC_SLIP_DECODER_BUFFER_SIZE];
-    unsigned int bufferIndex;
+    OscPacket oscPacket; // decoded bytes of the current SLIP packet
+    bool isEscaped; // previous byte was SLIP_ESC
+    bool isDiscarding; // current SLIP packet is corrupt and will be discarded
+    unsigned int bundleElementIndex; // index of the next bundle element size when cut-through processing
+    OscTimeTag oscTimeTag; // OSC time tag of the bundle when cut-through processing
     void ( *processPacket)(void* param, OscPacket * const oscPacket);
+    void ( *processMessage)(void* param, const OscTimeTag * const oscTimeTag, OscMessage * const oscMessage);
     void* param;
 } OscSlipDecoder;
 
@@ -40,6 +39,7 @@ typedef struct {
 // Function prototypes
 
 OscError OscSlipEncodePacket(const OscPacket * const oscPacket, size_t * const slipPacketSize, char * const destination, const size_t destinationSize);
+OscError OscSlipEncodePackets(const OscPacket * const oscPackets[], const unsigned int numberOfPackets, size_t * const slipPacketsSize, char * const destination, const size_t destinationSize);
 void OscSlipDecoderInitialise(OscSlipDecoder * const oscSlipDecoder);
 OscError OscSlipDecoderProcessByte(OscSlipDecoder * const oscSlipDecoder, const char byte);
 void OscSlipDecoderClearBuffer(OscSlipDecoder * const oscSlipDecoder);
@@ -0,0 +1,239 @@
+/**
+ * @file OscSnapshot.c
+ * @author Seb Madgwick
+ * @brief Functions and structures for maintaining serialised OSC bundles of
+ * the OSC messages held by an OSC state structure so that the complete state
+ * may be sent to a new client without constructing each OSC message.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscSnapshot.h"
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static OscError UpdateBundle(OscSnapshot * const oscSnapshot, const unsigned int bundleIndex);
+static OscError BuildBundle(OscSnapshot * const oscSnapshot, const unsigned int bundleIndex);
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Initialises an OSC snapshot structure.
+ *
+ * An OSC snapshot structure must be initialised before use.  A SendBundle
+ * function must be implemented within the application and assigned to the
+ * OSC snapshot structure after initialisation.
+ *
+ * Example use:
+ * @code
+ * void SendBundle(void* param, const char * const source, const size_t numberOfBytes) {
+ * }
+ *
+ * void Main() {
+ *     OscSnapshot oscSnapshot;
+ *     OscSnapshotInitialise(&oscSnapshot, &oscState);
+ *     oscSnapshot.sendBundle = SendBundle;
+ * }
+ * @endcode
+ *
+ * @param oscSnapshot OSC snapshot structure to be initialised.
+ * @param oscState OSC state structure containing the slots to be serialised.
+ */
+void OscSnapshotInitialise(OscSnapshot * const oscSnapshot, const OscState * const oscState) {
+    oscSnapshot->oscState = oscState;
+    unsigned int bundleIndex;
+    for (bundleIndex = 0; bundleIndex < MAX_OSC_SNAPSHOT_BUNDLES; bundleIndex++) {
+        oscSnapshot->bundles[bundleIndex].size = 0;
+        oscSnapshot->bundles[bundleIndex].numberOfSlots = 0;
+        oscSnapshot->bundles[bundleIndex].numberOfMessages = 0;
+    }
+    oscSnapshot->sendBundle = NULL;
+    oscSnapshot->param = NULL;
+}
+
+/**
+ * @brief Updates the serialised OSC bundles with each slot that has changed
+ * since the previous update.
+ *
+ * A slot is identified as changed by its sequence count so the writer of the
+ * OSC state structure does not need to be aware of the OSC snapshot.  A
+ * changed OSC message is copied over the previous OSC message within the OSC
+ * bundle if the size is unchanged.  Otherwise, the OSC bundle containing the
+ * slot is rebuilt.  OSC bundles that do not contain changed slots are not
+ * modified.  This function should be called periodically and must not be
+ * called at the same time as OscSnapshotSend.
+ *
+ * Example use:
+ * @code
+ * while(true) {
+ *     OscSnapshotUpdate(&oscSnapshot);
+ * }
+ * @endcode
+ *
+ * @param oscSnapshot OSC snapshot structure.
+ * @return Error code (0 if successful).
+ */
+OscError OscSnapshotUpdate(OscSnapshot * const oscSnapshot) {
+    unsigned int bundleIndex;
+    for (bundleIndex = 0; bundleIndex < MAX_OSC_SNAPSHOT_BUNDLES; bundleIndex++) {
+        const OscError oscError = UpdateBundle(oscSnapshot, bundleIndex);
+        if (oscError != OscErrorNone) {
+            return oscError;
+        }
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Provides each serialised OSC bundle containing at least one OSC
+ * message to the SendBundle function.
+ *
+ * Each OSC bundle has an OSC time tag of "immediately" and does not exceed
+ * MAX_OSC_BUNDLE_SIZE.  The OSC bundles remain valid until the next call to
+ * OscSnapshotUpdate so the SendBundle function may collect the OSC bundles and
+ * send them together.
+ *
+ * Example use:
+ * @code
+ * oscSnapshot.param = &newClient;
+ * OscSnapshotSend(&oscSnapshot);
+ * @endcode
+ *
+ * @param oscSnapshot OSC snapshot structure.
+ * @return Error code (0 if successful).
+ */
+OscError OscSnapshotSend(const OscSnapshot * const oscSnapshot) {
+    if (oscSnapshot->sendBundle == NULL) {
+        return OscErrorCallbackFunctionUndefined; // error: user function undefined
+    }
+    unsigned int bundleIndex;
+    for (bundleIndex = 0; bundleIndex < MAX_OSC_SNAPSHOT_BUNDLES; bundleIndex++) {
+        const OscSnapshotBundle * const bundle = &oscSnapshot->bundles[bundleIndex];
+        if (bundle->numberOfMessages > 0) {
+            oscSnapshot->sendBundle(oscSnapshot->param, bundle->contents, bundle->size);
+        }
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Copies each changed OSC message into an OSC bundle, or rebuilds the
+ * OSC bundle if an OSC message has changed size or slots have been added.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscSnapshot OSC snapshot structure.
+ * @param bundleIndex Index of the OSC bundle.
+ * @return Error code (0 if successful).
+ */
+static OscError UpdateBundle(OscSnapshot * const oscSnapshot, const unsigned int bundleIndex) {
+    const OscState * const oscState = oscSnapshot->oscState;
+    OscSnapshotBundle * const bundle = &oscSnapshot->bundles[bundleIndex];
+
+    // Determine slots included in OSC bundle
+    const unsigned int firstSlot = bundleIndex * OSC_SNAPSHOT_SLOTS_PER_BUNDLE;
+    unsigned int numberOfSlots = 0;
+    if (oscState->numberOfSlots > firstSlot) {
+        numberOfSlots = oscState->numberOfSlots - firstSlot;
+        if (numberOfSlots > OSC_SNAPSHOT_SLOTS_PER_BUNDLE) {
+            numberOfSlots = OSC_SNAPSHOT_SLOTS_PER_BUNDLE;
+        }
+    }
+    if (numberOfSlots != bundle->numberOfSlots) {
+        return BuildBundle(oscSnapshot, bundleIndex); // slots added
+    }
+
+    // Copy changed OSC messages
+    unsigned int slotIndex;
+    for (slotIndex = firstSlot; slotIndex < (firstSlot + numberOfSlots); slotIndex++) {
+        if (OscStateGetSequence(oscState, slotIndex) == oscSnapshot->sequences[slotIndex]) {
+            continue; // slot unchanged
+        }
+        char contents[OSC_STATE_SLOT_SIZE];
+        size_t size;
+        unsigned int sequence;
+        const OscError oscError = OscStateReadContents(oscState, slotIndex, &size, contents, sizeof (contents), &sequence);
+        if (oscError != OscErrorNone) {
+            return oscError;
+        }
+        if ((size == 0) || (size != oscSnapshot->sizes[slotIndex])) {
+            return BuildBundle(oscSnapshot, bundleIndex); // size changed
+        }
+        char * const destination = &bundle->contents[oscSnapshot->offsets[slotIndex]];
+        unsigned int contentsIndex;
+        for (contentsIndex = 0; contentsIndex < size; contentsIndex++) {
+            destination[contentsIndex] = contents[contentsIndex];
+        }
+        oscSnapshot->sequences[slotIndex] = sequence;
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Builds an OSC bundle from the OSC message held by each included slot.
+ * Slots that have not yet been updated are omitted.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscSnapshot OSC snapshot structure.
+ * @param bundleIndex Index of the OSC bundle.
+ * @return Error code (0 if successful).
+ */
+static OscError BuildBundle(OscSnapshot * const oscSnapshot, const unsigned int bundleIndex) {
+    const OscState * const oscState = oscSnapshot->oscState;
+    OscSnapshotBundle * const bundle = &oscSnapshot->bundles[bundleIndex];
+
+    // Write OSC bundle header and OSC time tag of "immediately"
+    size_t bundleSize = 0;
+    unsigned int headerIndex;
+    for (headerIndex = 0; headerIndex < sizeof (OSC_BUNDLE_HEADER); headerIndex++) {
+        bundle->contents[bundleSize++] = OSC_BUNDLE_HEADER[headerIndex];
+    }
+    OscTimeTag oscTimeTag;
+    oscTimeTag.value = 1;
+    bundle->contents[bundleSize++] = oscTimeTag.byteStruct.byte7;
+    bundle->contents[bundleSize++] = oscTimeTag.byteStruct.byte6;
+    bundle->contents[bundleSize++] = oscTimeTag.byteStruct.byte5;
+    bundle->contents[bundleSize++] = oscTimeTag.byteStruct.byte4;
+    bundle->contents[bundleSize++] = oscTimeTag.byteStruct.byte3;
+    bundle->contents[bundleSize++] = oscTimeTag.byteStruct.byte2;
+    bundle->contents[bundleSize++] = oscTimeTag.byteStruct.byte1;
+    bundle->contents[bundleSize++] = oscTimeTag.byteStruct.byte0;
+
+    // Write OSC bundle elements
+    const unsigned int firstSlot = bundleIndex * OSC_SNAPSHOT_SLOTS_PER_BUNDLE;
+    bundle->numberOfSlots = 0;
+    bundle->numberOfMessages = 0;
+    while (((firstSlot + bundle->numberOfSlots) < oscState->numberOfSlots) && (bundle->numberOfSlots < OSC_SNAPSHOT_SLOTS_PER_BUNDLE)) {
+        const unsigned int slotIndex = firstSlot + bundle->numberOfSlots++;
+        const size_t offset = bundleSize + sizeof (OscArgument32);
+        size_t size;
+        const OscError oscError = OscStateReadContents(oscState, slotIndex, &size, &bundle->contents[offset], OSC_STATE_SLOT_SIZE, &oscSnapshot->sequences[slotIndex]);
+        if (oscError != OscErrorNone) {
+            bundle->numberOfMessages = 0; // OSC bundle is incomplete
+            return oscError;
+        }
+        oscSnapshot->offsets[slotIndex] = offset;
+        oscSnapshot->sizes[slotIndex] = size;
+        if (size == 0) {
+            continue; // slot not yet updated
+        }
+        OscArgument32 elementSize;
+        elementSize.int32 = (int32_t) size;
+        bundle->contents[bundleSize++] = elementSize.byteStruct.byte3;
+        bundle->contents[bundleSize++] = elementSize.byteStruct.byte2;
+        bundle->contents[bundleSize++] = elementSize.byteStruct.byte1;
+        bundle->contents[bundleSize++] = elementSize.byteStruct.byte0;
+        bundleSize += size;
+        bundle->numberOfMessages++;
+    }
+    bundle->size = bundleSize;
+    return OscErrorNone;
+}
+
+//------------------------------------------------------------------------------
+// End of file
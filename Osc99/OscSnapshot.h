@@ -0,0 +1,78 @@
+/**
+ * @file OscSnapshot.h
+ * @author Seb Madgwick
+ * @brief Functions and structures for maintaining serialised OSC bundles of
+ * the OSC messages held by an OSC state structure so that the complete state
+ * may be sent to a new client without constructing each OSC message.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_SNAPSHOT_H
+#define OSC_SNAPSHOT_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscBundle.h"
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscState.h"
+#include <stddef.h>
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Number of slots included in each OSC bundle.  Each OSC bundle is
+ * able to contain the largest OSC message of every included slot so that a
+ * slot never needs to be moved to another OSC bundle.
+ */
+#define OSC_SNAPSHOT_SLOTS_PER_BUNDLE ((MAX_OSC_BUNDLE_SIZE - MIN_OSC_BUNDLE_SIZE) / (sizeof (OscArgument32) + OSC_STATE_SLOT_SIZE))
+
+// sizeof cannot be evaluated by the preprocessor so MIN_OSC_BUNDLE_SIZE (16)
+// and sizeof (OscArgument32) (4) are written as literals
+#if (OSC_STATE_SLOT_SIZE + 4) > (MAX_OSC_BUNDLE_SIZE - 16)
+#error "OSC_STATE_SLOT_SIZE is too large for a slot to be included in an OSC bundle"
+#endif
+
+/**
+ * @brief Number of OSC bundles required to include every slot.
+ */
+#define MAX_OSC_SNAPSHOT_BUNDLES ((MAX_OSC_STATE_SLOTS + OSC_SNAPSHOT_SLOTS_PER_BUNDLE - 1) / OSC_SNAPSHOT_SLOTS_PER_BUNDLE)
+
+/**
+ * @brief OSC snapshot bundle structure.  This structure is used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    char contents[MAX_OSC_BUNDLE_SIZE];
+    size_t size;
+    unsigned int numberOfSlots; // number of slots included when last built
+    unsigned int numberOfMessages;
+} OscSnapshotBundle;
+
+/**
+ * @brief OSC snapshot structure.  Structure members are used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    const OscState * oscState;
+    OscSnapshotBundle bundles[MAX_OSC_SNAPSHOT_BUNDLES];
+    unsigned int sequences[MAX_OSC_STATE_SLOTS]; // sequence count of each slot when last serialised
+    size_t offsets[MAX_OSC_STATE_SLOTS]; // offset of each OSC message within the OSC bundle
+    size_t sizes[MAX_OSC_STATE_SLOTS]; // size of each OSC message, zero if not included
+    void ( *sendBundle)(void* param, const char * const source, const size_t numberOfBytes);
+    void* param;
+} OscSnapshot;
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+void OscSnapshotInitialise(OscSnapshot * const oscSnapshot, const OscState * const oscState);
+OscError OscSnapshotUpdate(OscSnapshot * const oscSnapshot);
+OscError OscSnapshotSend(const OscSnapshot * const oscSnapshot);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
@@ -0,0 +1,407 @@
+/**
+ * @file OscState.c
+ * @author Seb Madgwick
+ * @brief Functions and structures for mirroring the most recent OSC message
+ * received for each of a set of OSC addresses.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscHash.h"
+#include "OscState.h"
+#include <string.h> // strcmp, strlen
+#ifdef _MSC_VER
+#include <windows.h> // MemoryBarrier
+#endif
+
+//------------------------------------------------------------------------------
+// Definitions
+
+#ifndef OSC_MEMORY_BARRIER
+#error "OSC_MEMORY_BARRIER must be defined in OscCommon.h for this compiler"
+#endif
+
+/**
+ * @brief Index value indicating that an index entry is unused.
+ */
+#define NO_INDEX ((unsigned int) -1)
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static bool IsSlotValid(const OscStateSlot * const slot);
+static unsigned int FindIndexEntry(const OscState * const oscState, const char * const oscAddress);
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Initialises an OSC state structure.
+ *
+ * An OSC state structure must be initialised before use.  Slots must then be
+ * added for each OSC address to be mirrored.  All slots should be added
+ * before the OSC state structure is shared with readers.
+ *
+ * The OSC state structure allows a single writer, typically the receive path,
+ * to update the most recent OSC message for each OSC address while any number
+ * of readers, such as an audio thread, read consistent copies without locks.
+ * Each slot is protected by a sequence count that is odd while the slot is
+ * being written.  A reader retries if the sequence count changes while it
+ * copies the slot and so a reader never blocks the writer.  A reader must not
+ * preempt the writer, for example from an interrupt, because the reader would
+ * retry indefinitely while the writer is unable to complete the write.
+ *
+ * Example use:
+ * @code
+ * OscState oscState;
+ * OscStateInitialise(&oscState);
+ * @endcode
+ *
+ * @param oscState OSC state structure to be initialised.
+ */
+void OscStateInitialise(OscState * const oscState) {
+    oscState->magic = OSC_STATE_MAGIC;
+    oscState->version = OSC_STATE_VERSION;
+    oscState->size = sizeof (OscState);
+    oscState->numberOfSlots = 0;
+    unsigned int indexEntry;
+    for (indexEntry = 0; indexEntry < OSC_STATE_INDEX_SIZE; indexEntry++) {
+        oscState->index[indexEntry] = NO_INDEX;
+    }
+}
+
+/**
+ * @brief Restores an OSC state structure located in memory that has persisted
+ * from a previous run of the application.
+ *
+ * This function allows the most recent OSC messages from before a restart to
+ * be read immediately, without waiting for each OSC message to be received
+ * again.  The contents of each slot are used as they are.  A slot that was
+ * being written when the application stopped is cleared, and the hash index
+ * is rebuilt.  An error is returned if the memory does not contain a valid
+ * OSC state structure of the same layout, in which case the OSC state
+ * structure must be initialised with OscStateInitialise.  Slots added after
+ * restoring are appended to the restored slots.
+ *
+ * Example use:
+ * @code
+ * OscState * const oscState = mmap(NULL, sizeof(OscState), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+ * if(OscStateRestore(oscState) != OscErrorNone) {
+ *     OscStateInitialise(oscState);
+ * }
+ * @endcode
+ *
+ * @param oscState OSC state structure to be restored.
+ * @return Error code (0 if successful).
+ */
+OscError OscStateRestore(OscState * const oscState) {
+    if ((oscState->magic != OSC_STATE_MAGIC) || (oscState->version != OSC_STATE_VERSION) || (oscState->size != sizeof (OscState))) {
+        return OscErrorInvalidStateHeader; // error: not a valid OSC state structure
+    }
+    if (oscState->numberOfSlots > MAX_OSC_STATE_SLOTS) {
+        return OscErrorInvalidStateHeader; // error: invalid number of slots
+    }
+    unsigned int slotIndex;
+    for (slotIndex = 0; slotIndex < oscState->numberOfSlots; slotIndex++) {
+        if (IsSlotValid(&oscState->slots[slotIndex]) == false) {
+            return OscErrorInvalidStateHeader; // error: invalid slot
+        }
+    }
+
+    // Clear incomplete slots
+    for (slotIndex = 0; slotIndex < oscState->numberOfSlots; slotIndex++) {
+        OscStateSlot * const slot = &oscState->slots[slotIndex];
+        if (((slot->sequence & 1) != 0) || (slot->size > OSC_STATE_SLOT_SIZE)) {
+            slot->size = 0;
+            slot->sequence = (slot->sequence | 1) + 1;
+        }
+    }
+
+    // Rebuild index
+    unsigned int indexEntry;
+    for (indexEntry = 0; indexEntry < OSC_STATE_INDEX_SIZE; indexEntry++) {
+        oscState->index[indexEntry] = NO_INDEX;
+    }
+    for (slotIndex = 0; slotIndex < oscState->numberOfSlots; slotIndex++) {
+        indexEntry = FindIndexEntry(oscState, oscState->slots[slotIndex].oscAddress);
+        if (oscState->index[indexEntry] != NO_INDEX) {
+            return OscErrorInvalidStateHeader; // error: duplicate address
+        }
+        oscState->index[indexEntry] = slotIndex;
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Adds a slot for an OSC address.
+ *
+ * The index of the slot is written to slotIndex so that readers may read the
+ * slot without looking up the OSC address.  The index of the existing slot is
+ * provided if a slot has already been added for the OSC address.
+ *
+ * Example use:
+ * @code
+ * unsigned int gainSlot;
+ * OscStateAddSlot(&oscState, "/mixer/gain", &gainSlot);
+ * @endcode
+ *
+ * @param oscState OSC state structure.
+ * @param oscAddress OSC address.
+ * @param slotIndex Index of the slot.
+ * @return Error code (0 if successful).
+ */
+OscError OscStateAddSlot(OscState * const oscState, const char * const oscAddress, unsigned int * const slotIndex) {
+    if (*oscAddress != '/') {
+        return OscErrorNoSlashAtStartOfMessage; // error: address must start with '/'
+    }
+    if (strlen(oscAddress) > MAX_OSC_ADDRESS_PATTERN_LENGTH) {
+        return OscErrorAddressPatternTooLong; // error: address too long
+    }
+    const unsigned int indexEntry = FindIndexEntry(oscState, oscAddress);
+    if (oscState->index[indexEntry] != NO_INDEX) {
+        *slotIndex = oscState->index[indexEntry];
+        return OscErrorNone; // slot already exists
+    }
+    if (oscState->numberOfSlots >= MAX_OSC_STATE_SLOTS) {
+        return OscErrorTooManyStateSlots; // error: too many slots
+    }
+    OscStateSlot * const slot = &oscState->slots[oscState->numberOfSlots];
+    strcpy(slot->oscAddress, oscAddress);
+    slot->sequence = 0;
+    slot->size = 0;
+    OSC_MEMORY_BARRIER(); // slot must be complete before it is indexed
+    oscState->index[indexEntry] = oscState->numberOfSlots;
+    *slotIndex = oscState->numberOfSlots++;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Finds the slot for an OSC address.
+ *
+ * Example use:
+ * @code
+ * unsigned int slotIndex;
+ * if(OscStateFindSlot(&oscState, "/mixer/gain", &slotIndex) == true) {
+ *     printf("Slot index is %u", slotIndex);
+ * }
+ * @endcode
+ *
+ * @param oscState OSC state structure.
+ * @param oscAddress OSC address.
+ * @param slotIndex Index of the slot.
+ * @return True if a slot exists for the OSC address.
+ */
+bool OscStateFindSlot(const OscState * const oscState, const char * const oscAddress, unsigned int * const slotIndex) {
+    const unsigned int indexEntry = FindIndexEntry(oscState, oscAddress);
+    if (oscState->index[indexEntry] == NO_INDEX) {
+        return false;
+    }
+    *slotIndex = oscState->index[indexEntry];
+    return true;
+}
+
+/**
+ * @brief Updates the slot for the OSC address pattern of an OSC message.
+ *
+ * The OSC address pattern of the OSC message must be identical to the OSC
+ * address of a slot.  This function must only be called by a single writer.
+ * The OSC message is serialised before the slot is written so that the slot
+ * is marked as being written for the duration of a single copy.
+ *
+ * Example use:
+ * @code
+ * void ProcessMessage(const OscTimeTag * const oscTimeTag, OscMessage * const oscMessage) {
+ *     OscStateUpdate(&oscState, oscMessage);
+ * }
+ * @endcode
+ *
+ * @param oscState OSC state structure.
+ * @param oscMessage OSC message.
+ * @return Error code (0 if successful).
+ */
+OscError OscStateUpdate(OscState * const oscState, const OscMessage * const oscMessage) {
+    unsigned int slotIndex;
+    if (OscStateFindSlot(oscState, oscMessage->oscAddressPattern, &slotIndex) == false) {
+        return OscErrorStateSlotNotFound; // error: no slot for address
+    }
+    if (OscMessageGetSize(oscMessage) > OSC_STATE_SLOT_SIZE) {
+        return OscErrorMessageTooLargeForStateSlot; // error: message too large
+    }
+    char contents[OSC_STATE_SLOT_SIZE];
+    size_t size;
+    const OscError oscError = OscMessageToCharArray(oscMessage, &size, contents, sizeof (contents));
+    if (oscError != OscErrorNone) {
+        return oscError; // error: message could not be serialised
+    }
+
+    // Write slot
+    OscStateSlot * const slot = &oscState->slots[slotIndex];
+    slot->sequence++; // odd while writing
+    OSC_MEMORY_BARRIER();
+    unsigned int contentsIndex;
+    for (contentsIndex = 0; contentsIndex < size; contentsIndex++) {
+        slot->contents[contentsIndex] = contents[contentsIndex];
+    }
+    slot->size = size;
+    OSC_MEMORY_BARRIER();
+    slot->sequence++; // even when complete
+    return OscErrorNone;
+}
+
+/**
+ * @brief Reads a consistent copy of the most recent OSC message held by a
+ * slot.
+ *
+ * This function does not block the writer and may be called by any number of
+ * readers.  The slot is copied again if it was written during the copy.
+ *
+ * Example use:
+ * @code
+ * OscMessage oscMessage;
+ * if(OscStateRead(&oscState, gainSlot, &oscMessage) == OscErrorNone) {
+ *     float gain;
+ *     OscMessageGetArgumentAsFloat32(&oscMessage, &gain);
+ * }
+ * @endcode
+ *
+ * @param oscState OSC state structure.
+ * @param slotIndex Index of the slot.
+ * @param oscMessage OSC message to be initialised from the slot.
+ * @return Error code (0 if successful).
+ */
+OscError OscStateRead(const OscState * const oscState, const unsigned int slotIndex, OscMessage * const oscMessage) {
+    char contents[OSC_STATE_SLOT_SIZE];
+    size_t size;
+    const OscError oscError = OscStateReadContents(oscState, slotIndex, &size, contents, sizeof (contents), NULL);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    if (size == 0) {
+        return OscErrorStateSlotEmpty; // error: slot not yet updated
+    }
+    return OscMessageInitialiseFromCharArray(oscMessage, contents, size);
+}
+
+/**
+ * @brief Reads a consistent copy of the OSC message held by a slot as a char
+ * array in the OSC wire format.
+ *
+ * The size will be zero if the slot has not yet been updated.  The sequence
+ * count of the copy is written to sequence, if not NULL, and may be compared
+ * with OscStateGetSequence to determine if the slot has since been updated.
+ *
+ * Example use:
+ * @code
+ * char contents[OSC_STATE_SLOT_SIZE];
+ * size_t size;
+ * OscStateReadContents(&oscState, gainSlot, &size, contents, sizeof(contents), NULL);
+ * @endcode
+ *
+ * @param oscState OSC state structure.
+ * @param slotIndex Index of the slot.
+ * @param size Size of the OSC message.
+ * @param destination Destination.
+ * @param destinationSize Destination size that cannot exceed.
+ * @param sequence Sequence count of the copy.  May be NULL.
+ * @return Error code (0 if successful).
+ */
+OscError OscStateReadContents(const OscState * const oscState, const unsigned int slotIndex, size_t * const size, char * const destination, const size_t destinationSize, unsigned int * const sequence) {
+    if (slotIndex >= oscState->numberOfSlots) {
+        return OscErrorStateSlotNotFound; // error: invalid slot index
+    }
+    const OscStateSlot * const slot = &oscState->slots[slotIndex];
+    unsigned int sequenceBefore;
+    size_t slotSize;
+    do {
+        sequenceBefore = slot->sequence;
+        OSC_MEMORY_BARRIER();
+        slotSize = slot->size;
+        *size = slotSize;
+        if (*size > OSC_STATE_SLOT_SIZE) {
+            *size = OSC_STATE_SLOT_SIZE; // size may be inconsistent while writing
+        }
+        if (*size > destinationSize) {
+            *size = destinationSize; // size may be inconsistent while writing
+        }
+        unsigned int contentsIndex;
+        for (contentsIndex = 0; contentsIndex < *size; contentsIndex++) {
+            destination[contentsIndex] = slot->contents[contentsIndex];
+        }
+        OSC_MEMORY_BARRIER();
+    } while (((sequenceBefore & 1) != 0) || (sequenceBefore != slot->sequence));
+    if (slotSize > destinationSize) {
+        return OscErrorDestinationTooSmall; // error: destination too small
+    }
+    if (sequence != NULL) {
+        *sequence = sequenceBefore;
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Returns the sequence count of a slot.  The sequence count changes
+ * each time the slot is updated.
+ *
+ * Example use:
+ * @code
+ * if(OscStateGetSequence(&oscState, gainSlot) != previousSequence) {
+ *     printf("Gain has changed");
+ * }
+ * @endcode
+ *
+ * @param oscState OSC state structure.
+ * @param slotIndex Index of the slot.  Must be a valid slot index.
+ * @return Sequence count of the slot.
+ */
+unsigned int OscStateGetSequence(const OscState * const oscState, const unsigned int slotIndex) {
+    return oscState->slots[slotIndex].sequence;
+}
+
+/**
+ * @brief Returns true if the OSC address of a restored slot is valid.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param slot Slot.
+ * @return True if the OSC address of the slot is valid.
+ */
+static bool IsSlotValid(const OscStateSlot * const slot) {
+    if (slot->oscAddress[0] != '/') {
+        return false;
+    }
+    unsigned int addressIndex;
+    for (addressIndex = 0; addressIndex <= MAX_OSC_ADDRESS_PATTERN_LENGTH; addressIndex++) {
+        if (slot->oscAddress[addressIndex] == '\0') {
+            return true;
+        }
+    }
+    return false; // address not terminated
+}
+
+/**
+ * @brief Returns the index entry for an OSC address.  The index entry will
+ * either contain the index of the slot for the OSC address or will be unused.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscState OSC state structure.
+ * @param oscAddress OSC address.
+ * @return Index entry.
+ */
+static unsigned int FindIndexEntry(const OscState * const oscState, const char * const oscAddress) {
+
+    // Linear probing
+    unsigned int indexEntry = (unsigned int) (OscHashBytes(oscAddress, strlen(oscAddress)) % OSC_STATE_INDEX_SIZE);
+    while (oscState->index[indexEntry] != NO_INDEX) {
+        if (strcmp(oscState->slots[oscState->index[indexEntry]].oscAddress, oscAddress) == 0) {
+            break;
+        }
+        indexEntry = (indexEntry + 1) % OSC_STATE_INDEX_SIZE;
+    }
+    return indexEntry;
+}
+
+//------------------------------------------------------------------------------
+// End of file
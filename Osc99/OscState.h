@@ -0,0 +1,103 @@
+/**
+ * @file OscState.h
+ * @author Seb Madgwick
+ * @brief Functions and structures for mirroring the most recent OSC message
+ * received for each of a set of OSC addresses.
+ *
+ * MAX_OSC_STATE_SLOTS and OSC_STATE_SLOT_SIZE may be modified as required by
+ * the user application.
+ *
+ * The OSC state structure contains no pointers and each slot holds an OSC
+ * message in the OSC wire format so that the structure may be located in
+ * memory that persists between restarts, such as a memory-mapped file or
+ * uninitialised RAM.
+ *
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_STATE_H
+#define OSC_STATE_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscMessage.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Maximum number of slots.  Each slot holds the most recent OSC message
+ * for one OSC address.  This value may be modified as required by the user
+ * application.
+ */
+#define MAX_OSC_STATE_SLOTS (64)
+
+/**
+ * @brief Maximum size of the OSC message held by each slot.  Must be a
+ * multiple of four.  This value may be modified as required by the user
+ * application.
+ */
+#define OSC_STATE_SLOT_SIZE (64)
+
+/**
+ * @brief Number of entries in the OSC address hash index.  Must be greater
+ * than MAX_OSC_STATE_SLOTS.
+ */
+#define OSC_STATE_INDEX_SIZE (2 * MAX_OSC_STATE_SLOTS)
+
+/**
+ * @brief Value used to identify an initialised OSC state structure.
+ */
+#define OSC_STATE_MAGIC (0x4F534353) // "OSCS"
+
+/**
+ * @brief OSC state structure layout version.  Incremented each time the
+ * layout of the OSC state structure changes.
+ */
+#define OSC_STATE_VERSION (1)
+
+/**
+ * @brief OSC state slot structure.  This structure is used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    char oscAddress[MAX_OSC_ADDRESS_PATTERN_LENGTH + 1];
+    volatile unsigned int sequence; // odd while the contents are being written
+    volatile size_t size; // zero until the first update
+    volatile char contents[OSC_STATE_SLOT_SIZE];
+} OscStateSlot;
+
+/**
+ * @brief OSC state structure.  Structure members are used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size; // size of structure
+    OscStateSlot slots[MAX_OSC_STATE_SLOTS];
+    unsigned int numberOfSlots;
+    unsigned int index[OSC_STATE_INDEX_SIZE]; // slot indexes
+} OscState;
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+void OscStateInitialise(OscState * const oscState);
+OscError OscStateRestore(OscState * const oscState);
+OscError OscStateAddSlot(OscState * const oscState, const char * const oscAddress, unsigned int * const slotIndex);
+bool OscStateFindSlot(const OscState * const oscState, const char * const oscAddress, unsigned int * const slotIndex);
+OscError OscStateUpdate(OscState * const oscState, const OscMessage * const oscMessage);
+OscError OscStateRead(const OscState * const oscState, const unsigned int slotIndex, OscMessage * const oscMessage);
+OscError OscStateReadContents(const OscState * const oscState, const unsigned int slotIndex, size_t * const size, char * const destination, const size_t destinationSize, unsigned int * const sequence);
+unsigned int OscStateGetSequence(const OscState * const oscState, const unsigned int slotIndex);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
@@ -0,0 +1,280 @@
+/**
+ * @file OscStream.c
+ * @author Seb Madgwick
+ * @brief Functions and structures for framing OSC packets into a write buffer
+ * for stream transports such as TCP so that multiple OSC packets may be sent
+ * with a single write.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscSlip.h"
+#include "OscStream.h"
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static OscError FramePacket(OscStream * const oscStream, const OscPacket * const oscPacket, const OscTimeTag currentTime);
+static OscError Flush(OscStream * const oscStream, const bool isMoreExpected);
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Initialises an OSC stream structure.
+ *
+ * An OSC stream structure must be initialised before use.  A Write function
+ * must be implemented within the application and assigned to the OSC stream
+ * structure after initialisation.  The Write function is provided with a hint
+ * indicating if more data is expected to follow immediately, for example, so
+ * that a Linux application may call send with MSG_MORE.
+ *
+ * Example use:
+ * @code
+ * void Write(void* param, const char * const source, const size_t numberOfBytes, const bool isMoreExpected) {
+ *     send(*(int*)param, source, numberOfBytes, isMoreExpected ? MSG_MORE : 0);
+ * }
+ *
+ * void Main() {
+ *     OscTimeTag maximumDelay;
+ *     maximumDelay.value = 0x100000000 / 500; // 2 ms
+ *     OscStream oscStream;
+ *     OscStreamInitialise(&oscStream, OscStreamFramingSlip, OscStreamLatencyNormal, maximumDelay);
+ *     oscStream.write = Write;
+ *     oscStream.param = &mySocket;
+ * }
+ * @endcode
+ *
+ * @param oscStream OSC stream structure to be initialised.
+ * @param framing Framing used to delimit OSC packets.
+ * @param latency Latency class.
+ * @param maximumDelay Maximum time that an OSC packet may remain in the write
+ * buffer for a latency class of OscStreamLatencyNormal.
+ */
+void OscStreamInitialise(OscStream * const oscStream, const OscStreamFraming framing, const OscStreamLatency latency, const OscTimeTag maximumDelay) {
+    oscStream->bufferSize = 0;
+    oscStream->framing = framing;
+    oscStream->latency = latency;
+    oscStream->maximumDelay = maximumDelay;
+    oscStream->deadline = oscTimeTagZero;
+    oscStream->statistics.numberOfPackets = 0;
+    oscStream->statistics.numberOfWrites = 0;
+    oscStream->statistics.numberOfBytes = 0;
+    oscStream->write = NULL;
+    oscStream->param = NULL;
+}
+
+/**
+ * @brief Adds an OSC packet to the write buffer.
+ *
+ * The OSC packet is framed and written to the write buffer.  The write buffer
+ * is first flushed if it does not have the capacity for the framed OSC packet.
+ * The write buffer is flushed immediately for a latency class of
+ * OscStreamLatencyLow.
+ *
+ * Example use:
+ * @code
+ * OscStreamAddPacket(&oscStream, &oscPacket, MyGetCurrentTime());
+ * @endcode
+ *
+ * @param oscStream OSC stream structure.
+ * @param oscPacket OSC packet to be sent.
+ * @param currentTime Current time.
+ * @return Error code (0 if successful).
+ */
+OscError OscStreamAddPacket(OscStream * const oscStream, const OscPacket * const oscPacket, const OscTimeTag currentTime) {
+    if (oscStream->write == NULL) {
+        return OscErrorCallbackFunctionUndefined; // error: user function undefined
+    }
+    if (oscPacket->size == 0) {
+        return OscErrorContentsEmpty; // error: contents empty
+    }
+
+    // Frame OSC packet, flushing write buffer if full
+    if (FramePacket(oscStream, oscPacket, currentTime) != OscErrorNone) {
+        if (oscStream->bufferSize == 0) {
+            return OscErrorFramedPacketTooLargeForStream; // error: framed packet cannot fit in empty buffer
+        }
+        Flush(oscStream, true);
+        if (FramePacket(oscStream, oscPacket, currentTime) != OscErrorNone) {
+            return OscErrorFramedPacketTooLargeForStream; // error: framed packet cannot fit in empty buffer
+        }
+    }
+    oscStream->statistics.numberOfPackets++;
+
+    // Flush immediately for low latency
+    if (oscStream->latency == OscStreamLatencyLow) {
+        return Flush(oscStream, false);
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Flushes the write buffer if the maximum delay has elapsed for a
+ * latency class of OscStreamLatencyNormal.
+ *
+ * This function should be called periodically with the current time.
+ *
+ * Example use:
+ * @code
+ * while(true) {
+ *     OscStreamProcess(&oscStream, MyGetCurrentTime());
+ * }
+ * @endcode
+ *
+ * @param oscStream OSC stream structure.
+ * @param currentTime Current time.
+ * @return Error code (0 if successful).
+ */
+OscError OscStreamProcess(OscStream * const oscStream, const OscTimeTag currentTime) {
+    OscTimeTag deadline;
+    if (OscStreamGetDeadline(oscStream, &deadline) == false) {
+        return OscErrorNone;
+    }
+    if (currentTime.value < deadline.value) {
+        return OscErrorNone;
+    }
+    return OscStreamFlush(oscStream);
+}
+
+/**
+ * @brief Flushes the write buffer.
+ *
+ * This function should be called when the application has no more OSC packets
+ * to send for the time being, for example, at the end of processing a received
+ * OSC packet.
+ *
+ * Example use:
+ * @code
+ * OscStreamFlush(&oscStream);
+ * @endcode
+ *
+ * @param oscStream OSC stream structure.
+ * @return Error code (0 if successful).
+ */
+OscError OscStreamFlush(OscStream * const oscStream) {
+    if (oscStream->write == NULL) {
+        return OscErrorCallbackFunctionUndefined; // error: user function undefined
+    }
+    return Flush(oscStream, false);
+}
+
+/**
+ * @brief Gets the time at which the write buffer will be flushed by
+ * OscStreamProcess.
+ *
+ * An example use of this function would be to determine how long the
+ * application may sleep before OscStreamProcess must next be called.
+ *
+ * Example use:
+ * @code
+ * OscTimeTag deadline;
+ * if(OscStreamGetDeadline(&oscStream, &deadline) == true) {
+ *     MySleepUntil(deadline);
+ * }
+ * @endcode
+ *
+ * @param oscStream OSC stream structure.
+ * @param deadline Time at which the write buffer will be flushed.
+ * @return True if the write buffer will be flushed by OscStreamProcess.
+ */
+bool OscStreamGetDeadline(const OscStream * const oscStream, OscTimeTag * const deadline) {
+    if ((oscStream->latency != OscStreamLatencyNormal) || (oscStream->bufferSize == 0)) {
+        return false;
+    }
+    *deadline = oscStream->deadline;
+    return true;
+}
+
+/**
+ * @brief Gets the OSC stream statistics.
+ *
+ * Example use:
+ * @code
+ * OscStreamStatistics statistics;
+ * OscStreamGetStatistics(&oscStream, &statistics);
+ * printf("%f writes per packet", (float) statistics.numberOfWrites / (float) statistics.numberOfPackets);
+ * @endcode
+ *
+ * @param oscStream OSC stream structure.
+ * @param statistics OSC stream statistics.
+ */
+void OscStreamGetStatistics(const OscStream * const oscStream, OscStreamStatistics * const statistics) {
+    *statistics = oscStream->statistics;
+}
+
+/**
+ * @brief Frames an OSC packet and writes it to the write buffer.  The deadline
+ * is set if the write buffer was empty.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscStream OSC stream structure.
+ * @param oscPacket OSC packet.
+ * @param currentTime Current time.
+ * @return Error code (0 if successful).
+ */
+static OscError FramePacket(OscStream * const oscStream, const OscPacket * const oscPacket, const OscTimeTag currentTime) {
+    char * const destination = &oscStream->buffer[oscStream->bufferSize];
+    const size_t destinationSize = OSC_STREAM_BUFFER_SIZE - oscStream->bufferSize;
+    size_t framedPacketSize = 0;
+    switch (oscStream->framing) {
+        case OscStreamFramingSlip:
+        {
+            const OscError oscError = OscSlipEncodePacket(oscPacket, &framedPacketSize, destination, destinationSize);
+            if (oscError != OscErrorNone) {
+                return oscError;
+            }
+            break;
+        }
+        case OscStreamFramingSizePrefix:
+        default:
+        {
+            if ((sizeof (OscArgument32) + oscPacket->size) > destinationSize) {
+                return OscErrorDestinationTooSmall; // error: destination too small
+            }
+            OscArgument32 size;
+            size.int32 = (int32_t) oscPacket->size;
+            destination[framedPacketSize++] = size.byteStruct.byte3;
+            destination[framedPacketSize++] = size.byteStruct.byte2;
+            destination[framedPacketSize++] = size.byteStruct.byte1;
+            destination[framedPacketSize++] = size.byteStruct.byte0;
+            unsigned int packetIndex;
+            for (packetIndex = 0; packetIndex < oscPacket->size; packetIndex++) {
+                destination[framedPacketSize++] = oscPacket->contents[packetIndex];
+            }
+            break;
+        }
+    }
+    if (oscStream->bufferSize == 0) {
+        oscStream->deadline.value = currentTime.value + oscStream->maximumDelay.value;
+    }
+    oscStream->bufferSize += framedPacketSize;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Provides the contents of the write buffer to the Write function and
+ * empties the write buffer.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscStream OSC stream structure.
+ * @param isMoreExpected True if more data will be written immediately.
+ * @return Error code (0 if successful).
+ */
+static OscError Flush(OscStream * const oscStream, const bool isMoreExpected) {
+    if (oscStream->bufferSize == 0) {
+        return OscErrorNone;
+    }
+    oscStream->write(oscStream->param, oscStream->buffer, oscStream->bufferSize, isMoreExpected);
+    oscStream->statistics.numberOfWrites++;
+    oscStream->statistics.numberOfBytes += oscStream->bufferSize;
+    oscStream->bufferSize = 0;
+    return OscErrorNone;
+}
+
+//------------------------------------------------------------------------------
+// End of file
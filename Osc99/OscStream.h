@@ -0,0 +1,92 @@
+/**
+ * @file OscStream.h
+ * @author Seb Madgwick
+ * @brief Functions and structures for framing OSC packets into a write buffer
+ * for stream transports such as TCP so that multiple OSC packets may be sent
+ * with a single write.
+ *
+ * OSC_STREAM_BUFFER_SIZE may be modified as required by the user application.
+ *
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_STREAM_H
+#define OSC_STREAM_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscPacket.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Size of the write buffer.  Must be able to contain at least one framed
+ * OSC packet.  This value may be modified as required by the user application.
+ */
+#define OSC_STREAM_BUFFER_SIZE (4 * MAX_TRANSPORT_SIZE)
+
+/**
+ * @brief Framing used to delimit OSC packets within the stream.
+ */
+typedef enum {
+    OscStreamFramingSlip, // OSC 1.1
+    OscStreamFramingSizePrefix, // OSC 1.0
+} OscStreamFraming;
+
+/**
+ * @brief Latency class determining when the write buffer is flushed.  The
+ * application should configure the transport to match, for example, by
+ * enabling TCP_NODELAY for OscStreamLatencyLow.
+ */
+typedef enum {
+    OscStreamLatencyLow, // flushed after each OSC packet
+    OscStreamLatencyNormal, // flushed when full or when the maximum delay has elapsed
+    OscStreamLatencyBulk, // flushed only when full or by OscStreamFlush
+} OscStreamLatency;
+
+/**
+ * @brief OSC stream statistics.  The average number of writes per OSC packet
+ * indicates the effectiveness of coalescing.
+ */
+typedef struct {
+    unsigned long numberOfPackets;
+    unsigned long numberOfWrites;
+    unsigned long numberOfBytes;
+} OscStreamStatistics;
+
+/**
+ * @brief OSC stream structure.  Structure members are used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    char buffer[OSC_STREAM_BUFFER_SIZE];
+    size_t bufferSize;
+    OscStreamFraming framing;
+    OscStreamLatency latency;
+    OscTimeTag maximumDelay;
+    OscTimeTag deadline; // time at which the buffer must be flushed if not empty
+    OscStreamStatistics statistics;
+    void ( *write)(void* param, const char * const source, const size_t numberOfBytes, const bool isMoreExpected);
+    void* param;
+} OscStream;
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+void OscStreamInitialise(OscStream * const oscStream, const OscStreamFraming framing, const OscStreamLatency latency, const OscTimeTag maximumDelay);
+OscError OscStreamAddPacket(OscStream * const oscStream, const OscPacket * const oscPacket, const OscTimeTag currentTime);
+OscError OscStreamProcess(OscStream * const oscStream, const OscTimeTag currentTime);
+OscError OscStreamFlush(OscStream * const oscStream);
+bool OscStreamGetDeadline(const OscStream * const oscStream, OscTimeTag * const deadline);
+void OscStreamGetStatistics(const OscStream * const oscStream, OscStreamStatistics * const statistics);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
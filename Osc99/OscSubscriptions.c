@@ -0,0 +1,373 @@
+/**
+ * @file OscSubscriptions.c
+ * @author Seb Madgwick
+ * @brief Functions and structures for matching OSC addresses to subscribed OSC
+ * address patterns.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscAddress.h"
+#include "OscSubscriptions.h"
+#include <string.h> // strcmp
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Index value indicating that a node or subscription does not exist.
+ */
+#define NO_INDEX ((unsigned int) -1)
+
+/**
+ * @brief Index of the root node.  The root node represents an empty literal
+ * prefix.
+ */
+#define ROOT_NODE_INDEX (0)
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static OscError AddSubscription(OscSubscriptions * const oscSubscriptions, const char * const oscAddressPattern, void * const subscriber, const bool isUnordered);
+static size_t GetLiteralPrefixLength(const char * oscAddressPattern);
+static unsigned int FindChildNode(const OscSubscriptions * const oscSubscriptions, const unsigned int nodeIndex, const char character);
+static void ProcessNode(OscSubscriptions * const oscSubscriptions, const unsigned int nodeIndex, const char * const oscAddress, const size_t oscAddressIndex);
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Initialises an OSC subscriptions structure.
+ *
+ * An OSC subscriptions structure must be initialised before use.  A
+ * ProcessSubscriber function must be implemented within the application and
+ * assigned to the OSC subscriptions structure after initialisation.  A
+ * ProcessUnorderedSubscriber function may also be assigned to receive
+ * subscribers added by OscSubscriptionsAddUnordered.
+ *
+ * Example use:
+ * @code
+ * void ProcessSubscriber(void* param, void* subscriber) {
+ * }
+ *
+ * void Main() {
+ *     OscSubscriptions oscSubscriptions;
+ *     OscSubscriptionsInitialise(&oscSubscriptions);
+ *     oscSubscriptions.processSubscriber = ProcessSubscriber;
+ * }
+ * @endcode
+ *
+ * @param oscSubscriptions OSC subscriptions structure to be initialised.
+ */
+void OscSubscriptionsInitialise(OscSubscriptions * const oscSubscriptions) {
+    unsigned int subscriptionIndex;
+    for (subscriptionIndex = 0; subscriptionIndex < MAX_OSC_SUBSCRIPTIONS; subscriptionIndex++) {
+        oscSubscriptions->subscriptions[subscriptionIndex].isUsed = false;
+    }
+    oscSubscriptions->nodes[ROOT_NODE_INDEX].character = '\0';
+    oscSubscriptions->nodes[ROOT_NODE_INDEX].firstChild = NO_INDEX;
+    oscSubscriptions->nodes[ROOT_NODE_INDEX].nextSibling = NO_INDEX;
+    oscSubscriptions->nodes[ROOT_NODE_INDEX].firstSubscription = NO_INDEX;
+    oscSubscriptions->numberOfNodes = 1;
+    oscSubscriptions->processSubscriber = NULL;
+    oscSubscriptions->processUnorderedSubscriber = NULL;
+    oscSubscriptions->param = NULL;
+}
+
+/**
+ * @brief Adds a subscription to an OSC address pattern.
+ *
+ * The OSC address pattern may contain any special characters: '?', ' *', '[]',
+ * '{}', or '//'.  The subscriber will be provided to the ProcessSubscriber
+ * function for each OSC address matched by the OSC address pattern.  The same
+ * subscriber may be added for multiple OSC address patterns.
+ *
+ * Example use:
+ * @code
+ * OscSubscriptionsAdd(&oscSubscriptions, "/mixer/channel/ * /fader", &myClient);
+ * @endcode
+ *
+ * @param oscSubscriptions OSC subscriptions structure.
+ * @param oscAddressPattern OSC address pattern.
+ * @param subscriber Subscriber to be provided to the ProcessSubscriber
+ * function.
+ * @return Error code (0 if successful).
+ */
+OscError OscSubscriptionsAdd(OscSubscriptions * const oscSubscriptions, const char * const oscAddressPattern, void * const subscriber) {
+    return AddSubscription(oscSubscriptions, oscAddressPattern, subscriber, false);
+}
+
+/**
+ * @brief Adds a subscription to an OSC address pattern for a subscriber that
+ * does not require OSC messages to be processed in order.
+ *
+ * This function is equivalent to OscSubscriptionsAdd except that the
+ * subscriber will be provided to the ProcessUnorderedSubscriber function,
+ * if assigned, instead of the ProcessSubscriber function.  An application may
+ * use the ProcessUnorderedSubscriber function to hand heavy and
+ * order-insensitive work to a pool of worker threads while the
+ * ProcessSubscriber function processes OSC messages sequentially in the order
+ * in which they were received.
+ *
+ * Example use:
+ * @code
+ * OscSubscriptionsAddUnordered(&oscSubscriptions, "/thumbnail/ *", &myDecoder);
+ * @endcode
+ *
+ * @param oscSubscriptions OSC subscriptions structure.
+ * @param oscAddressPattern OSC address pattern.
+ * @param subscriber Subscriber to be provided to the
+ * ProcessUnorderedSubscriber function.
+ * @return Error code (0 if successful).
+ */
+OscError OscSubscriptionsAddUnordered(OscSubscriptions * const oscSubscriptions, const char * const oscAddressPattern, void * const subscriber) {
+    return AddSubscription(oscSubscriptions, oscAddressPattern, subscriber, true);
+}
+
+/**
+ * @brief Adds a subscription to an OSC address pattern.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscSubscriptions OSC subscriptions structure.
+ * @param oscAddressPattern OSC address pattern.
+ * @param subscriber Subscriber.
+ * @param isUnordered Flag indicating if the subscriber does not require OSC
+ * messages to be processed in order.
+ * @return Error code (0 if successful).
+ */
+static OscError AddSubscription(OscSubscriptions * const oscSubscriptions, const char * const oscAddressPattern, void * const subscriber, const bool isUnordered) {
+    if (*oscAddressPattern != '/') {
+        return OscErrorNoSlashAtStartOfMessage; // error: address must start with '/'
+    }
+    if (strlen(oscAddressPattern) > MAX_OSC_ADDRESS_PATTERN_LENGTH) {
+        return OscErrorAddressPatternTooLong; // error: address pattern too long
+    }
+
+    // Find unused subscription
+    unsigned int subscriptionIndex = 0;
+    while (oscSubscriptions->subscriptions[subscriptionIndex].isUsed == true) {
+        if (++subscriptionIndex >= MAX_OSC_SUBSCRIPTIONS) {
+            return OscErrorTooManySubscriptions; // error: too many subscriptions
+        }
+    }
+
+    // Find or create node for each character of literal prefix
+    const size_t literalPrefixLength = GetLiteralPrefixLength(oscAddressPattern);
+    unsigned int nodeIndex = ROOT_NODE_INDEX;
+    size_t patternIndex;
+    for (patternIndex = 0; patternIndex < literalPrefixLength; patternIndex++) {
+        const unsigned int childIndex = FindChildNode(oscSubscriptions, nodeIndex, oscAddressPattern[patternIndex]);
+        if (childIndex != NO_INDEX) {
+            nodeIndex = childIndex;
+            continue;
+        }
+        if (oscSubscriptions->numberOfNodes >= MAX_OSC_SUBSCRIPTION_NODES) {
+            return OscErrorTooManySubscriptionNodes; // error: too many nodes
+        }
+        OscSubscriptionNode * const child = &oscSubscriptions->nodes[oscSubscriptions->numberOfNodes];
+        child->character = oscAddressPattern[patternIndex];
+        child->firstChild = NO_INDEX;
+        child->nextSibling = oscSubscriptions->nodes[nodeIndex].firstChild;
+        child->firstSubscription = NO_INDEX;
+        oscSubscriptions->nodes[nodeIndex].firstChild = oscSubscriptions->numberOfNodes;
+        nodeIndex = oscSubscriptions->numberOfNodes++;
+    }
+
+    // Attach subscription to node of last character of literal prefix
+    OscSubscription * const subscription = &oscSubscriptions->subscriptions[subscriptionIndex];
+    strcpy(subscription->oscAddressPattern, oscAddressPattern);
+    subscription->literalPrefixLength = literalPrefixLength;
+    subscription->isLiteral = oscAddressPattern[literalPrefixLength] == '\0';
+    subscription->isUnordered = isUnordered;
+    subscription->isUsed = true;
+    subscription->subscriber = subscriber;
+    subscription->nextSubscription = oscSubscriptions->nodes[nodeIndex].firstSubscription;
+    oscSubscriptions->nodes[nodeIndex].firstSubscription = subscriptionIndex;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Removes a subscription previously added by OscSubscriptionsAdd.
+ *
+ * Both the OSC address pattern and the subscriber must be equal to those
+ * provided to OscSubscriptionsAdd.  Nodes of the literal prefix tree are
+ * retained and will be reused by subsequent subscriptions that share the same
+ * literal prefix.
+ *
+ * Example use:
+ * @code
+ * OscSubscriptionsRemove(&oscSubscriptions, "/mixer/channel/ * /fader", &myClient);
+ * @endcode
+ *
+ * @param oscSubscriptions OSC subscriptions structure.
+ * @param oscAddressPattern OSC address pattern.
+ * @param subscriber Subscriber.
+ * @return Error code (0 if successful).
+ */
+OscError OscSubscriptionsRemove(OscSubscriptions * const oscSubscriptions, const char * const oscAddressPattern, void * const subscriber) {
+
+    // Find node of last character of literal prefix
+    const size_t literalPrefixLength = GetLiteralPrefixLength(oscAddressPattern);
+    unsigned int nodeIndex = ROOT_NODE_INDEX;
+    size_t patternIndex;
+    for (patternIndex = 0; patternIndex < literalPrefixLength; patternIndex++) {
+        nodeIndex = FindChildNode(oscSubscriptions, nodeIndex, oscAddressPattern[patternIndex]);
+        if (nodeIndex == NO_INDEX) {
+            return OscErrorSubscriptionNotFound; // error: subscription not found
+        }
+    }
+
+    // Find and remove subscription
+    unsigned int * subscriptionIndex = &oscSubscriptions->nodes[nodeIndex].firstSubscription;
+    while (*subscriptionIndex != NO_INDEX) {
+        OscSubscription * const subscription = &oscSubscriptions->subscriptions[*subscriptionIndex];
+        if ((subscription->subscriber == subscriber) && (strcmp(subscription->oscAddressPattern, oscAddressPattern) == 0)) {
+            subscription->isUsed = false;
+            *subscriptionIndex = subscription->nextSubscription;
+            return OscErrorNone;
+        }
+        subscriptionIndex = &subscription->nextSubscription;
+    }
+    return OscErrorSubscriptionNotFound; // error: subscription not found
+}
+
+/**
+ * @brief Provides each subscriber with an OSC address pattern that matches the
+ * OSC address to the ProcessSubscriber or ProcessUnorderedSubscriber function.
+ *
+ * The OSC address is matched character by character to the literal prefix
+ * tree so that only subscriptions with a literal prefix matching the start of
+ * the OSC address are evaluated.  The cost of this function therefore does not
+ * increase with the number of subscriptions that cannot match.  The
+ * application may forward the same serialised OSC packet to each subscriber so
+ * that the OSC packet does not need to be serialised for each subscriber.
+ *
+ * Subscriptions must not be added or removed within the ProcessSubscriber or
+ * ProcessUnorderedSubscriber functions.
+ *
+ * Example use:
+ * @code
+ * void ProcessPacket(void* param, OscPacket * const oscPacket) {
+ *     OscMessage oscMessage;
+ *     OscMessageInitialiseFromCharArray(&oscMessage, oscPacket->contents, oscPacket->size);
+ *     oscSubscriptions.param = oscPacket; // forward oscPacket to each subscriber
+ *     OscSubscriptionsMatch(&oscSubscriptions, oscMessage.oscAddressPattern);
+ * }
+ * @endcode
+ *
+ * @param oscSubscriptions OSC subscriptions structure.
+ * @param oscAddress OSC address.  The OSC address cannot contain any special
+ * characters: '?', ' *', '[]', or '{}'.
+ * @return Error code (0 if successful).
+ */
+OscError OscSubscriptionsMatch(OscSubscriptions * const oscSubscriptions, const char * const oscAddress) {
+    if (oscSubscriptions->processSubscriber == NULL) {
+        return OscErrorCallbackFunctionUndefined; // error: user function undefined
+    }
+    unsigned int nodeIndex = ROOT_NODE_INDEX;
+    size_t oscAddressIndex = 0;
+    do {
+        ProcessNode(oscSubscriptions, nodeIndex, oscAddress, oscAddressIndex);
+        if (oscAddress[oscAddressIndex] == '\0') {
+            break; // end of OSC address
+        }
+        nodeIndex = FindChildNode(oscSubscriptions, nodeIndex, oscAddress[oscAddressIndex++]);
+    } while (nodeIndex != NO_INDEX);
+    return OscErrorNone;
+}
+
+/**
+ * @brief Returns the number of characters that precede the first special
+ * character or path-traversal wildcard '//' in an OSC address pattern.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscAddressPattern OSC address pattern.
+ * @return Length of the literal prefix of the OSC address pattern.
+ */
+static size_t GetLiteralPrefixLength(const char * oscAddressPattern) {
+    size_t length = 0;
+    while (oscAddressPattern[length] != '\0') {
+        switch (oscAddressPattern[length]) {
+            case '?':
+            case '*':
+            case '[':
+            case '{':
+                return length;
+            case '/':
+                if (oscAddressPattern[length + 1] == '/') {
+                    return length;
+                }
+                break;
+            default:
+                break;
+        }
+        length++;
+    }
+    return length;
+}
+
+/**
+ * @brief Returns the index of the child node for a character.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscSubscriptions OSC subscriptions structure.
+ * @param nodeIndex Index of the parent node.
+ * @param character Character.
+ * @return Index of the child node or NO_INDEX if the child node does not
+ * exist.
+ */
+static unsigned int FindChildNode(const OscSubscriptions * const oscSubscriptions, const unsigned int nodeIndex, const char character) {
+    unsigned int childIndex = oscSubscriptions->nodes[nodeIndex].firstChild;
+    while (childIndex != NO_INDEX) {
+        if (oscSubscriptions->nodes[childIndex].character == character) {
+            break;
+        }
+        childIndex = oscSubscriptions->nodes[childIndex].nextSibling;
+    }
+    return childIndex;
+}
+
+/**
+ * @brief Provides each subscriber attached to a node with an OSC address
+ * pattern that matches the OSC address to the ProcessSubscriber or
+ * ProcessUnorderedSubscriber function.
+ *
+ * Only the part of each OSC address pattern that follows the literal prefix is
+ * matched because the literal prefix has already been matched.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscSubscriptions OSC subscriptions structure.
+ * @param nodeIndex Index of the node.
+ * @param oscAddress OSC address.
+ * @param oscAddressIndex Index of the first character of the OSC address that
+ * follows the literal prefix.
+ */
+static void ProcessNode(OscSubscriptions * const oscSubscriptions, const unsigned int nodeIndex, const char * const oscAddress, const size_t oscAddressIndex) {
+    unsigned int subscriptionIndex = oscSubscriptions->nodes[nodeIndex].firstSubscription;
+    while (subscriptionIndex != NO_INDEX) {
+        const OscSubscription * const subscription = &oscSubscriptions->subscriptions[subscriptionIndex];
+        bool isMatch;
+        if (subscription->isLiteral == true) {
+            isMatch = oscAddress[oscAddressIndex] == '\0';
+        } else {
+            isMatch = OscAddressMatch(&subscription->oscAddressPattern[subscription->literalPrefixLength], &oscAddress[oscAddressIndex]);
+        }
+        if (isMatch == true) {
+            if ((subscription->isUnordered == true) && (oscSubscriptions->processUnorderedSubscriber != NULL)) {
+                oscSubscriptions->processUnorderedSubscriber(oscSubscriptions->param, subscription->subscriber);
+            } else {
+                oscSubscriptions->processSubscriber(oscSubscriptions->param, subscription->subscriber);
+            }
+        }
+        subscriptionIndex = subscription->nextSubscription;
+    }
+}
+
+//------------------------------------------------------------------------------
+// End of file
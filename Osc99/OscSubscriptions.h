@@ -0,0 +1,92 @@
+/**
+ * @file OscSubscriptions.h
+ * @author Seb Madgwick
+ * @brief Functions and structures for matching OSC addresses to subscribed OSC
+ * address patterns.
+ *
+ * MAX_OSC_SUBSCRIPTIONS and MAX_OSC_SUBSCRIPTION_NODES may be modified as
+ * required by the user application.
+ *
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_SUBSCRIPTIONS_H
+#define OSC_SUBSCRIPTIONS_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscMessage.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Maximum number of subscriptions.  This value may be modified as
+ * required by the user application.
+ */
+#define MAX_OSC_SUBSCRIPTIONS (16)
+
+/**
+ * @brief Maximum number of nodes in the literal prefix tree.  Each node
+ * represents one character of the literal prefix of one or more subscribed
+ * OSC address patterns.  This value may be modified as required by the user
+ * application.
+ */
+#define MAX_OSC_SUBSCRIPTION_NODES (16 * MAX_OSC_SUBSCRIPTIONS)
+
+/**
+ * @brief OSC subscription structure.  This structure is used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    char oscAddressPattern[MAX_OSC_ADDRESS_PATTERN_LENGTH + 1];
+    size_t literalPrefixLength;
+    bool isLiteral;
+    bool isUnordered;
+    bool isUsed;
+    void* subscriber;
+    unsigned int nextSubscription;
+} OscSubscription;
+
+/**
+ * @brief OSC subscription node structure.  This structure is used internally
+ * and should not be used by the user application.
+ */
+typedef struct {
+    char character;
+    unsigned int firstChild;
+    unsigned int nextSibling;
+    unsigned int firstSubscription;
+} OscSubscriptionNode;
+
+/**
+ * @brief OSC subscriptions structure.  Structure members are used internally
+ * and should not be used by the user application.
+ */
+typedef struct {
+    OscSubscription subscriptions[MAX_OSC_SUBSCRIPTIONS];
+    OscSubscriptionNode nodes[MAX_OSC_SUBSCRIPTION_NODES];
+    unsigned int numberOfNodes;
+    void ( *processSubscriber)(void* param, void* subscriber);
+    void ( *processUnorderedSubscriber)(void* param, void* subscriber);
+    void* param;
+} OscSubscriptions;
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+void OscSubscriptionsInitialise(OscSubscriptions * const oscSubscriptions);
+OscError OscSubscriptionsAdd(OscSubscriptions * const oscSubscriptions, const char * const oscAddressPattern, void * const subscriber);
+OscError OscSubscriptionsAddUnordered(OscSubscriptions * const oscSubscriptions, const char * const oscAddressPattern, void * const subscriber);
+OscError OscSubscriptionsRemove(OscSubscriptions * const oscSubscriptions, const char * const oscAddressPattern, void * const subscriber);
+OscError OscSubscriptionsMatch(OscSubscriptions * const oscSubscriptions, const char * const oscAddress);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
@@ -0,0 +1,332 @@
+/**
+ * @file OscTemplate.c
+ * @author Seb Madgwick
+ * @brief Functions and structures for matching received OSC messages of a
+ * known shape against templates of their serialised OSC address pattern and
+ * OSC type tag string.
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscTemplate.h"
+#include <string.h> // memcmp, strlen
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static OscError GetArgument(const OscTemplateMessage * const oscTemplateMessage, const unsigned int argumentIndex, const OscTypeTag oscTypeTag, const char * * const argument);
+static size_t AddPaddedString(char * const destination, const char * const string);
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Initialises an OSC templates structure.
+ *
+ * An OSC templates structure must be initialised before use.  OSC templates
+ * may then be added for each OSC message of a known shape, that is, an OSC
+ * message with a known OSC address pattern and only fixed-size arguments.  A
+ * received OSC message that matches an OSC template is provided to the
+ * ProcessMessage function of the OSC template without parsing the OSC message
+ * or matching the OSC address pattern.  An OSC templates structure may be
+ * assigned to an OSC packet so that it is used for each OSC message within the
+ * OSC packet.
+ *
+ * Example use:
+ * @code
+ * OscTemplates oscTemplates;
+ * OscTemplatesInitialise(&oscTemplates);
+ * oscPacket.oscTemplates = &oscTemplates;
+ * @endcode
+ *
+ * @param oscTemplates OSC templates structure to be initialised.
+ */
+void OscTemplatesInitialise(OscTemplates * const oscTemplates) {
+    oscTemplates->numberOfTemplates = 0;
+}
+
+/**
+ * @brief Adds an OSC template.
+ *
+ * The OSC address pattern and OSC type tag string are serialised to form the
+ * prefix of the OSC template.  The OSC type tag string must contain only
+ * fixed-size arguments.
+ *
+ * Example use:
+ * @code
+ * void ProcessSensor(void* param, const OscTimeTag * const oscTimeTag, const OscTemplateMessage * const oscTemplateMessage) {
+ *     float x, y, z;
+ *     OscTemplateMessageGetFloat32(oscTemplateMessage, 0, &x);
+ *     OscTemplateMessageGetFloat32(oscTemplateMessage, 1, &y);
+ *     OscTemplateMessageGetFloat32(oscTemplateMessage, 2, &z);
+ * }
+ *
+ * void Main() {
+ *     OscTemplatesAdd(&oscTemplates, "/sensor/accelerometer", ",fff", ProcessSensor, NULL);
+ * }
+ * @endcode
+ *
+ * @param oscTemplates OSC templates structure.
+ * @param oscAddressPattern OSC address pattern as null terminated string.
+ * @param oscTypeTagString OSC type tag string, including comma, as a null
+ * terminated string.
+ * @param processMessage ProcessMessage function of the OSC template.
+ * @param param Parameter provided to the ProcessMessage function.
+ * @return Error code (0 if successful).
+ */
+OscError OscTemplatesAdd(OscTemplates * const oscTemplates, const char * const oscAddressPattern, const char * const oscTypeTagString, void ( *processMessage)(void* param, const OscTimeTag * const oscTimeTag, const OscTemplateMessage * const oscTemplateMessage), void* param) {
+    if (oscTemplates->numberOfTemplates >= MAX_OSC_TEMPLATES) {
+        return OscErrorTooManyTemplates; // error: too many templates
+    }
+    if (processMessage == NULL) {
+        return OscErrorCallbackFunctionUndefined; // error: user function undefined
+    }
+    if (oscAddressPattern[0] != '/') {
+        return OscErrorNoSlashAtStartOfMessage; // error: first character is not '/'
+    }
+    if (strlen(oscAddressPattern) > MAX_OSC_ADDRESS_PATTERN_LENGTH) {
+        return OscErrorAddressPatternTooLong; // error: OSC address pattern too long
+    }
+    if (oscTypeTagString[0] != ',') {
+        return OscErrorUnknownTypeTag; // error: type tag string does not start with comma
+    }
+    OscTemplate * const oscTemplate = &oscTemplates->templates[oscTemplates->numberOfTemplates];
+    const OscError oscError = OscSignatureInitialise(&oscTemplate->oscSignature, oscTypeTagString);
+    if (oscError != OscErrorNone) {
+        return oscError; // error: signature initialisation failed
+    }
+    if (oscTemplate->oscSignature.isValid == false) {
+        return OscErrorUnknownTypeTag; // error: type tag string contains unknown type tag
+    }
+    if (oscTemplate->oscSignature.isFixedSize == false) {
+        return OscErrorTemplateArgumentsNotFixedSize; // error: type tag string contains variable-size argument
+    }
+    oscTemplate->prefixSize = AddPaddedString(oscTemplate->prefix, oscAddressPattern);
+    oscTemplate->prefixSize += AddPaddedString(&oscTemplate->prefix[oscTemplate->prefixSize], oscTypeTagString);
+    oscTemplate->messageSize = oscTemplate->prefixSize + oscTemplate->oscSignature.argumentsSize;
+    oscTemplate->processMessage = processMessage;
+    oscTemplate->param = param;
+    oscTemplates->numberOfTemplates++;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Matches a serialised OSC message against each OSC template and
+ * provides the OSC message to the ProcessMessage function of the first OSC
+ * template that matches.
+ *
+ * An OSC message matches an OSC template if it has the same size and begins
+ * with the same bytes as the prefix of the OSC template.  Each comparison is
+ * a single memcmp that the compiler may implement with wide compares.
+ *
+ * Example use:
+ * @code
+ * if(OscTemplatesProcessMessage(&oscTemplates, NULL, source, numberOfBytes) == false) {
+ *     OscMessageInitialiseFromCharArray(&oscMessage, source, numberOfBytes);
+ * }
+ * @endcode
+ *
+ * @param oscTemplates OSC templates structure.
+ * @param oscTimeTag OSC time tag of the bundle containing the OSC message.
+ * Must be NULL if the OSC message is not within an OSC bundle.
+ * @param source Serialised OSC message.
+ * @param numberOfBytes Size of the serialised OSC message.
+ * @return True if the OSC message matched an OSC template.
+ */
+bool OscTemplatesProcessMessage(const OscTemplates * const oscTemplates, const OscTimeTag * const oscTimeTag, const char * const source, const size_t numberOfBytes) {
+    unsigned int templateIndex;
+    for (templateIndex = 0; templateIndex < oscTemplates->numberOfTemplates; templateIndex++) {
+        const OscTemplate * const oscTemplate = &oscTemplates->templates[templateIndex];
+        if (numberOfBytes != oscTemplate->messageSize) {
+            continue;
+        }
+        if (memcmp(source, oscTemplate->prefix, oscTemplate->prefixSize) != 0) {
+            continue;
+        }
+        OscTemplateMessage oscTemplateMessage;
+        oscTemplateMessage.oscSignature = &oscTemplate->oscSignature;
+        oscTemplateMessage.arguments = &source[oscTemplate->prefixSize];
+        oscTemplate->processMessage(oscTemplate->param, oscTimeTag, &oscTemplateMessage);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Gets a 32-bit integer argument from an OSC message matched by an OSC
+ * template.
+ *
+ * Example use:
+ * @code
+ * int32_t int32;
+ * OscTemplateMessageGetInt32(oscTemplateMessage, 0, &int32);
+ * @endcode
+ *
+ * @param oscTemplateMessage OSC message matched by an OSC template.
+ * @param argumentIndex Index of the argument.
+ * @param int32 Address of the 32-bit integer argument.
+ * @return Error code (0 if successful).
+ */
+OscError OscTemplateMessageGetInt32(const OscTemplateMessage * const oscTemplateMessage, const unsigned int argumentIndex, int32_t * const int32) {
+    const char * argument;
+    const OscError oscError = GetArgument(oscTemplateMessage, argumentIndex, OscTypeTagInt32, &argument);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    OscArgument32 oscArgument32;
+    oscArgument32.byteStruct.byte3 = argument[0];
+    oscArgument32.byteStruct.byte2 = argument[1];
+    oscArgument32.byteStruct.byte1 = argument[2];
+    oscArgument32.byteStruct.byte0 = argument[3];
+    *int32 = oscArgument32.int32;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Gets a 32-bit float argument from an OSC message matched by an OSC
+ * template.
+ *
+ * Example use:
+ * @code
+ * float float32;
+ * OscTemplateMessageGetFloat32(oscTemplateMessage, 0, &float32);
+ * @endcode
+ *
+ * @param oscTemplateMessage OSC message matched by an OSC template.
+ * @param argumentIndex Index of the argument.
+ * @param float32 Address of the 32-bit float argument.
+ * @return Error code (0 if successful).
+ */
+OscError OscTemplateMessageGetFloat32(const OscTemplateMessage * const oscTemplateMessage, const unsigned int argumentIndex, float * const float32) {
+    const char * argument;
+    const OscError oscError = GetArgument(oscTemplateMessage, argumentIndex, OscTypeTagFloat32, &argument);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    OscArgument32 oscArgument32;
+    oscArgument32.byteStruct.byte3 = argument[0];
+    oscArgument32.byteStruct.byte2 = argument[1];
+    oscArgument32.byteStruct.byte1 = argument[2];
+    oscArgument32.byteStruct.byte0 = argument[3];
+    *float32 = oscArgument32.float32;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Gets a 64-bit integer argument from an OSC message matched by an OSC
+ * template.
+ *
+ * Example use:
+ * @code
+ * int64_t int64;
+ * OscTemplateMessageGetInt64(oscTemplateMessage, 0, &int64);
+ * @endcode
+ *
+ * @param oscTemplateMessage OSC message matched by an OSC template.
+ * @param argumentIndex Index of the argument.
+ * @param int64 Address of the 64-bit integer argument.
+ * @return Error code (0 if successful).
+ */
+OscError OscTemplateMessageGetInt64(const OscTemplateMessage * const oscTemplateMessage, const unsigned int argumentIndex, int64_t * const int64) {
+    const char * argument;
+    const OscError oscError = GetArgument(oscTemplateMessage, argumentIndex, OscTypeTagInt64, &argument);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    OscArgument64 oscArgument64;
+    oscArgument64.byteStruct.byte7 = argument[0];
+    oscArgument64.byteStruct.byte6 = argument[1];
+    oscArgument64.byteStruct.byte5 = argument[2];
+    oscArgument64.byteStruct.byte4 = argument[3];
+    oscArgument64.byteStruct.byte3 = argument[4];
+    oscArgument64.byteStruct.byte2 = argument[5];
+    oscArgument64.byteStruct.byte1 = argument[6];
+    oscArgument64.byteStruct.byte0 = argument[7];
+    *int64 = (int64_t) oscArgument64.int64;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Gets a 64-bit double argument from an OSC message matched by an OSC
+ * template.
+ *
+ * Example use:
+ * @code
+ * Double64 double64;
+ * OscTemplateMessageGetDouble(oscTemplateMessage, 0, &double64);
+ * @endcode
+ *
+ * @param oscTemplateMessage OSC message matched by an OSC template.
+ * @param argumentIndex Index of the argument.
+ * @param double64 Address of the 64-bit double argument.
+ * @return Error code (0 if successful).
+ */
+OscError OscTemplateMessageGetDouble(const OscTemplateMessage * const oscTemplateMessage, const unsigned int argumentIndex, Double64 * const double64) {
+    const char * argument;
+    const OscError oscError = GetArgument(oscTemplateMessage, argumentIndex, OscTypeTagDouble, &argument);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    OscArgument64 oscArgument64;
+    oscArgument64.byteStruct.byte7 = argument[0];
+    oscArgument64.byteStruct.byte6 = argument[1];
+    oscArgument64.byteStruct.byte5 = argument[2];
+    oscArgument64.byteStruct.byte4 = argument[3];
+    oscArgument64.byteStruct.byte3 = argument[4];
+    oscArgument64.byteStruct.byte2 = argument[5];
+    oscArgument64.byteStruct.byte1 = argument[6];
+    oscArgument64.byteStruct.byte0 = argument[7];
+    *double64 = oscArgument64.double64;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Gets the address of an argument of the specified type from an OSC
+ * message matched by an OSC template.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param oscTemplateMessage OSC message matched by an OSC template.
+ * @param argumentIndex Index of the argument.
+ * @param oscTypeTag Expected OSC type tag of the argument.
+ * @param argument Address of the argument.
+ * @return Error code (0 if successful).
+ */
+static OscError GetArgument(const OscTemplateMessage * const oscTemplateMessage, const unsigned int argumentIndex, const OscTypeTag oscTypeTag, const char * * const argument) {
+    const OscSignature * const oscSignature = oscTemplateMessage->oscSignature;
+    if (argumentIndex >= oscSignature->numberOfArguments) {
+        return OscErrorNoArgumentsAvailable; // error: no argument at index
+    }
+    if (oscSignature->oscTypeTagString[argumentIndex + 1] != (char) oscTypeTag) { // skip comma
+        return OscErrorUnexpectedArgumentType; // error: unexpected argument type
+    }
+    *argument = &oscTemplateMessage->arguments[oscSignature->argumentOffsets[argumentIndex]];
+    return OscErrorNone;
+}
+
+/**
+ * @brief Writes a string followed by one to four null characters so that the
+ * written size is a multiple of four.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param destination Destination.
+ * @param string String as null terminated string.
+ * @return Written size.
+ */
+static size_t AddPaddedString(char * const destination, const char * const string) {
+    size_t size = 0;
+    while (string[size] != '\0') {
+        destination[size] = string[size];
+        size++;
+    }
+    do {
+        destination[size++] = '\0';
+    } while ((size % 4) != 0);
+    return size;
+}
+
+//------------------------------------------------------------------------------
+// End of file
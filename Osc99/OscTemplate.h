@@ -0,0 +1,87 @@
+/**
+ * @file OscTemplate.h
+ * @author Seb Madgwick
+ * @brief Functions and structures for matching received OSC messages of a
+ * known shape against templates of their serialised OSC address pattern and
+ * OSC type tag string.
+ *
+ * MAX_OSC_TEMPLATES may be modified as required by the user application.
+ *
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_TEMPLATE_H
+#define OSC_TEMPLATE_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscMessage.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Maximum number of OSC templates.  This value may be modified as
+ * required by the user application.
+ */
+#define MAX_OSC_TEMPLATES (20)
+
+/**
+ * @brief Maximum size of the serialised OSC address pattern and OSC type tag
+ * string, including padding, that forms the prefix of an OSC template.
+ */
+#define MAX_OSC_TEMPLATE_PREFIX_SIZE ((MAX_OSC_ADDRESS_PATTERN_LENGTH + 4) + (MAX_OSC_TYPE_TAG_STRING_LENGTH + 4))
+
+/**
+ * @brief OSC message matched by an OSC template.  The arguments remain within
+ * the received OSC packet and are read at the fixed offsets of the OSC
+ * signature.
+ */
+typedef struct {
+    const OscSignature * oscSignature;
+    const char * arguments;
+} OscTemplateMessage;
+
+/**
+ * @brief OSC template structure.  Structure members are used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    char prefix[MAX_OSC_TEMPLATE_PREFIX_SIZE];
+    size_t prefixSize;
+    size_t messageSize;
+    OscSignature oscSignature;
+    void ( *processMessage)(void* param, const OscTimeTag * const oscTimeTag, const OscTemplateMessage * const oscTemplateMessage);
+    void* param;
+} OscTemplate;
+
+/**
+ * @brief OSC templates structure.  Structure members are used internally and
+ * should not be used by the user application.
+ */
+typedef struct {
+    OscTemplate templates[MAX_OSC_TEMPLATES];
+    unsigned int numberOfTemplates;
+} OscTemplates;
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+void OscTemplatesInitialise(OscTemplates * const oscTemplates);
+OscError OscTemplatesAdd(OscTemplates * const oscTemplates, const char * const oscAddressPattern, const char * const oscTypeTagString, void ( *processMessage)(void* param, const OscTimeTag * const oscTimeTag, const OscTemplateMessage * const oscTemplateMessage), void* param);
+bool OscTemplatesProcessMessage(const OscTemplates * const oscTemplates, const OscTimeTag * const oscTimeTag, const char * const source, const size_t numberOfBytes);
+OscError OscTemplateMessageGetInt32(const OscTemplateMessage * const oscTemplateMessage, const unsigned int argumentIndex, int32_t * const int32);
+OscError OscTemplateMessageGetFloat32(const OscTemplateMessage * const oscTemplateMessage, const unsigned int argumentIndex, float * const float32);
+OscError OscTemplateMessageGetInt64(const OscTemplateMessage * const oscTemplateMessage, const unsigned int argumentIndex, int64_t * const int64);
+OscError OscTemplateMessageGetDouble(const OscTemplateMessage * const oscTemplateMessage, const unsigned int argumentIndex, Double64 * const double64);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file
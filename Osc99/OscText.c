@@ -0,0 +1,1653 @@
+/**
+ * @file OscText.c
+ * @author Seb Madgwick
+ * @brief Functions for converting between OSC packets and text.  Each OSC
+ * message is represented by a line of text containing the OSC address pattern,
+ * the OSC type tag string, and the arguments, for example:
+ * /example ,ifsb 1 2.5 "text" 0x0102
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include <errno.h> // errno, ERANGE
+#include <float.h> // DBL_MANT_DIG
+#include <math.h> // fabsf, floor, isinf, log10, signbit
+#include "OscBundle.h"
+#include "OscFormat.h"
+#include "OscText.h"
+#include <locale.h> // localeconv
+#include <stdio.h> // snprintf
+#include <stdlib.h> // strtod, strtof
+#include <string.h> // memchr, memcpy, memmove, strlen, strncmp
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Length of the text of an OSC time tag.
+ */
+#define TIME_TAG_TEXT_LENGTH (17)
+
+/**
+ * @brief Maximum number of significant digits required for a float32 to
+ * round-trip.
+ */
+#define FLOAT32_MAX_DIGITS (9)
+
+/**
+ * @brief Largest mantissa of a float32 parsed without rounding.
+ */
+#define FLOAT32_EXACT_MANTISSA_LIMIT ((uint64_t) 1 << 24)
+
+/**
+ * @brief Largest power of ten exactly representable as a float32.
+ */
+#define FLOAT32_EXACT_POWER_OF_TEN_LIMIT (10)
+
+#if DBL_MANT_DIG == 53
+
+/**
+ * @brief Largest mantissa of a double parsed without rounding.  Only defined
+ * if double is IEEE 754 double precision.
+ */
+#define DOUBLE_EXACT_MANTISSA_LIMIT ((uint64_t) 1 << 53)
+
+/**
+ * @brief Largest power of ten exactly representable as a double.  Only
+ * defined if double is IEEE 754 double precision.
+ */
+#define DOUBLE_EXACT_POWER_OF_TEN_LIMIT (22)
+
+#endif
+
+/**
+ * @brief Maximum number of significant digits accumulated by the decimal
+ * parser.  Numbers with more digits are parsed by the standard library.
+ */
+#define MAX_DECIMAL_DIGITS (19)
+
+/**
+ * @brief Text reader structure.  The text index advances from the start to the
+ * end of a single line.
+ */
+typedef struct {
+    const char * text;
+    size_t textIndex;
+    size_t lineEnd;
+} TextReader;
+
+/**
+ * @brief Two-digit decimal strings for each value from 0 to 99.
+ */
+static const char twoDigits[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+#if DBL_MANT_DIG >= 53
+
+/**
+ * @brief Powers of ten from 1e0 to 1e63.  Only defined if double is wider than
+ * float32.
+ */
+static const double powersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+    1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22, 1e23,
+    1e24, 1e25, 1e26, 1e27, 1e28, 1e29, 1e30, 1e31,
+    1e32, 1e33, 1e34, 1e35, 1e36, 1e37, 1e38, 1e39,
+    1e40, 1e41, 1e42, 1e43, 1e44, 1e45, 1e46, 1e47,
+    1e48, 1e49, 1e50, 1e51, 1e52, 1e53, 1e54, 1e55,
+    1e56, 1e57, 1e58, 1e59, 1e60, 1e61, 1e62, 1e63
+};
+
+#endif
+
+/**
+ * @brief Powers of ten from 1e0 to 1e10 that are exactly representable as a
+ * float32.
+ */
+static const float float32PowersOfTen[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f,
+    1e8f, 1e9f, 1e10f
+};
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+static OscError FormatContents(OscFormatWriter * const textWriter, const OscTimeTag * const oscTimeTag, const char * const oscContents, const size_t contentsSize);
+static OscError FormatMessage(OscFormatWriter * const textWriter, const char * const source, const size_t numberOfBytes);
+static void WriteAddressPattern(OscFormatWriter * const textWriter, const char * const source, const size_t numberOfBytes);
+static void WriteQuoted(OscFormatWriter * const textWriter, const char * const source, const size_t numberOfBytes, const char quote);
+static void WriteHexadecimal(OscFormatWriter * const textWriter, const char * const source, const size_t numberOfBytes);
+static void WriteTimeTag(OscFormatWriter * const textWriter, const OscTimeTag oscTimeTag);
+static size_t FormatUnsigned(uint64_t value, char * const text);
+static size_t FormatStandardLibrary(const double value, const int precision, char * const text);
+#if DBL_MANT_DIG >= 53
+static bool IsFloat32Digits(const uint64_t digits, const int scale, const float float32);
+#endif
+static void WriteBundleHeader(OscFormatWriter * const textWriter, const OscTimeTag oscTimeTag);
+static OscError ParseMessage(TextReader * const textReader, OscFormatWriter * const textWriter);
+static bool IsWhitespace(const char character);
+static void SkipWhitespace(TextReader * const textReader);
+static size_t GetTokenEnd(const TextReader * const textReader);
+static bool ParseAddressPattern(TextReader * const textReader, OscFormatWriter * const textWriter);
+static bool ParseQuoted(TextReader * const textReader, OscFormatWriter * const textWriter, const char quote);
+static bool ParseHexadecimal(TextReader * const textReader, OscFormatWriter * const textWriter, size_t * const numberOfBytes);
+static bool ParseDecimal(const char * const text, const size_t textLength, bool * const isNegative, uint64_t * const mantissa, int * const exponent);
+static bool CopyNumber(const char * const text, const size_t textLength, char * const number);
+
+//------------------------------------------------------------------------------
+// Functions
+
+/**
+ * @brief Formats an OSC packet as text.
+ *
+ * Each OSC message within the OSC packet is written as a line of text
+ * terminated by a new line character.  Each OSC message within an OSC bundle
+ * is preceded by the OSC time tag of the OSC bundle as two 32-bit hexadecimal
+ * numbers, for example: 83AA7E80.00000000 /example ,f 0.5.  The text is not
+ * null terminated.
+ *
+ * Whitespace, backslashes, and characters that are not printable within the
+ * OSC address pattern are written as \xHH.  Strings and characters are written
+ * within double and single quotes respectively.  A quote or backslash is
+ * preceded by a backslash and any character that is not printable is written
+ * as \xHH.  Blobs, 32-bit RGBA
+ * colours, and 4 byte MIDI messages are written as 0x followed by the
+ * hexadecimal bytes.  OSC time tags are written in the same format as the OSC
+ * time tag of an OSC bundle.  Floats are written using the fewest digits that
+ * round-trip.  No text is written for arguments without data such as true or
+ * nil.
+ *
+ * Example use:
+ * @code
+ * char text[4096];
+ * size_t textSize;
+ * if(OscTextFormatPacket(&oscPacket, &textSize, text, sizeof(text)) == OscErrorNone) {
+ *     fwrite(text, 1, textSize, myLogFile);
+ * }
+ * @endcode
+ *
+ * @param oscPacket OSC packet to be formatted.
+ * @param textSize Size of the text.
+ * @param destination Destination address of the text.
+ * @param destinationSize Size of the destination.
+ * @return Error code (0 if successful).
+ */
+OscError OscTextFormatPacket(const OscPacket * const oscPacket, size_t * const textSize, char * const destination, const size_t destinationSize) {
+    return OscTextFormatContents(oscPacket->contents, oscPacket->size, textSize, destination, destinationSize);
+}
+
+/**
+ * @brief Formats OSC contents as text.
+ *
+ * This function is equivalent to OscTextFormatPacket and may be used to format
+ * an OSC message or OSC bundle that has been received into a buffer without
+ * first copying it to an OSC packet.
+ *
+ * Example use:
+ * @code
+ * OscTextFormatContents(myBuffer, myBufferSize, &textSize, text, sizeof(text));
+ * @endcode
+ *
+ * @param oscContents OSC message or OSC bundle to be formatted.
+ * @param contentsSize Size of the OSC contents.
+ * @param textSize Size of the text.
+ * @param destination Destination address of the text.
+ * @param destinationSize Size of the destination.
+ * @return Error code (0 if successful).
+ */
+OscError OscTextFormatContents(const void * const oscContents, const size_t contentsSize, size_t * const textSize, char * const destination, const size_t destinationSize) {
+    *textSize = 0; // size will be 0 if function unsuccessful
+    OscFormatWriter textWriter;
+    OscFormatWriterInitialise(&textWriter, destination, destinationSize);
+    const OscError oscError = FormatContents(&textWriter, NULL, (const char *) oscContents, contentsSize);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    if (textWriter.isFull == true) {
+        return OscErrorDestinationTooSmall; // error: destination too small
+    }
+    *textSize = textWriter.size;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Parses lines of text as OSC packets.
+ *
+ * Each line is parsed in the format written by OscTextFormatPacket and
+ * written to the destination as an OSC packet preceded by its 32-bit size, as
+ * for a stream using OscStreamFramingSizePrefix.  Consecutive lines preceded
+ * by the same OSC time tag are written as the OSC messages of a single OSC
+ * bundle until the OSC bundle is full.  Empty lines and lines starting with #
+ * are ignored.  A type tag string is not required for an OSC message with no
+ * arguments.
+ *
+ * Parsing stops at the first line that does not fit within the destination.
+ * The text parsed indicates the start of the first line not parsed and may be
+ * used to continue parsing once the destination has been processed.  If a
+ * line cannot be parsed then the text parsed indicates the start of the line
+ * and the contents size indicates the OSC packets written for the preceding
+ * lines.  Each line is parsed directly into the destination and so the
+ * destination beyond the contents size may be modified.
+ *
+ * Example use:
+ * @code
+ * char contents[4096];
+ * size_t textParsed;
+ * size_t contentsSize;
+ * size_t textIndex = 0;
+ * while (textIndex < textSize) {
+ *     if (OscTextParseLines(&text[textIndex], textSize - textIndex, &textParsed, &contentsSize, contents, sizeof(contents)) != OscErrorNone) {
+ *         break;
+ *     }
+ *     MySend(contents, contentsSize);
+ *     textIndex += textParsed;
+ * }
+ * @endcode
+ *
+ * @param text Text to be parsed.
+ * @param textSize Size of the text.
+ * @param textParsed Size of the text parsed.
+ * @param contentsSize Size of the OSC packets written to the destination.
+ * @param destination Destination address of the OSC packets.
+ * @param destinationSize Size of the destination.
+ * @return Error code (0 if successful).
+ */
+OscError OscTextParseLines(const char * const text, const size_t textSize, size_t * const textParsed, size_t * const contentsSize, char * const destination, const size_t destinationSize) {
+    *textParsed = 0;
+    *contentsSize = 0;
+    OscFormatWriter textWriter;
+    OscFormatWriterInitialise(&textWriter, destination, destinationSize);
+    bool isBundleOpen = false;
+    size_t bundleIndex = 0; // index of size of open OSC bundle
+    OscTimeTag bundleOscTimeTag;
+    bundleOscTimeTag.value = 0;
+    size_t lineStart = 0;
+    while (lineStart < textSize) {
+
+        // Find end of line
+        const char * const newLine = memchr(&text[lineStart], '\n', textSize - lineStart);
+        TextReader textReader;
+        textReader.text = text;
+        textReader.textIndex = lineStart;
+        textReader.lineEnd = (newLine == NULL) ? textSize : (size_t) (newLine - text);
+        const size_t nextLineStart = (newLine == NULL) ? textSize : (textReader.lineEnd + 1);
+
+        // Ignore empty lines and comments
+        SkipWhitespace(&textReader);
+        if ((textReader.textIndex == textReader.lineEnd) || (text[textReader.textIndex] == '#')) {
+            lineStart = nextLineStart;
+            *textParsed = lineStart;
+            continue;
+        }
+
+        // Parse optional OSC time tag
+        bool hasTimeTag = false;
+        OscTimeTag oscTimeTag;
+        oscTimeTag.value = 0;
+        if (text[textReader.textIndex] != '/') {
+            const size_t tokenEnd = GetTokenEnd(&textReader);
+            if (OscTextParseTimeTag(&text[textReader.textIndex], tokenEnd - textReader.textIndex, &oscTimeTag) == false) {
+                return OscErrorInvalidTextTimeTag; // error: invalid OSC time tag
+            }
+            textReader.textIndex = tokenEnd;
+            SkipWhitespace(&textReader);
+            hasTimeTag = true;
+        }
+
+        // Write OSC bundle header unless OSC message is within open OSC bundle
+        const size_t elementIndex = textWriter.size; // index of size of OSC packet or OSC bundle element
+        bool isWithinOpenBundle = (hasTimeTag == true) && (isBundleOpen == true) && (oscTimeTag.value == bundleOscTimeTag.value);
+        if ((hasTimeTag == true) && (isWithinOpenBundle == false)) {
+            WriteBundleHeader(&textWriter, oscTimeTag);
+        }
+        OscFormatWriterWrite(&textWriter, "\0\0\0\0", sizeof (OscArgument32)); // written below
+
+        // Parse OSC message directly into destination
+        size_t messageSize = 0;
+        if (textWriter.isFull == false) {
+            const size_t messageIndex = textWriter.size;
+            const size_t sizeAvailable = destinationSize - messageIndex;
+            OscFormatWriter messageWriter;
+            OscFormatWriterInitialise(&messageWriter, &destination[messageIndex], (sizeAvailable < MAX_OSC_MESSAGE_SIZE) ? sizeAvailable : MAX_OSC_MESSAGE_SIZE);
+            const OscError oscError = ParseMessage(&textReader, &messageWriter);
+            if ((oscError == OscErrorMessageSizeTooLarge) && (sizeAvailable < MAX_OSC_MESSAGE_SIZE)) {
+                textWriter.isFull = true;
+            } else if (oscError != OscErrorNone) {
+                return oscError;
+            } else {
+                messageSize = messageWriter.size;
+                textWriter.size += messageSize;
+            }
+        }
+
+        // Move OSC message to new OSC bundle if open OSC bundle is full
+        if ((isWithinOpenBundle == true) && (textWriter.isFull == false) && ((textWriter.size - bundleIndex - sizeof (OscArgument32)) > MAX_OSC_BUNDLE_SIZE)) {
+            const size_t bundleHeaderSize = sizeof (OscArgument32) + MIN_OSC_BUNDLE_SIZE;
+            if ((textWriter.size + bundleHeaderSize) > destinationSize) {
+                textWriter.isFull = true;
+            } else {
+                const size_t messageIndex = elementIndex + sizeof (OscArgument32);
+                memmove(&destination[messageIndex + bundleHeaderSize], &destination[messageIndex], messageSize);
+                textWriter.size = elementIndex;
+                WriteBundleHeader(&textWriter, oscTimeTag);
+                textWriter.size += sizeof (OscArgument32) + messageSize; // OSC bundle element size written below
+                isWithinOpenBundle = false;
+            }
+        }
+        if (textWriter.isFull == true) {
+            if (*contentsSize == 0) {
+                return OscErrorDestinationTooSmall; // error: destination too small
+            }
+            return OscErrorNone;
+        }
+        if ((hasTimeTag == true) && (isWithinOpenBundle == false)) {
+            if ((MIN_OSC_BUNDLE_SIZE + sizeof (OscArgument32) + messageSize) > MAX_OSC_BUNDLE_SIZE) {
+                return OscErrorBundleSizeTooLarge; // error: OSC message too large for OSC bundle
+            }
+            bundleIndex = elementIndex;
+            bundleOscTimeTag = oscTimeTag;
+        }
+        isBundleOpen = hasTimeTag;
+
+        // Write sizes
+        OscFormatWriteInt32(&destination[textWriter.size - messageSize - sizeof (OscArgument32)], (int32_t) messageSize);
+        if (isBundleOpen == true) {
+            OscFormatWriteInt32(&destination[bundleIndex], (int32_t) (textWriter.size - bundleIndex - sizeof (OscArgument32)));
+        }
+        lineStart = nextLineStart;
+        *textParsed = lineStart;
+        *contentsSize = textWriter.size;
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Parses a line of text as an OSC message.
+ *
+ * The text is parsed in the format written by OscTextFormatPacket for an OSC
+ * message that is not within an OSC bundle.  The serialised OSC message is
+ * written to the destination.
+ *
+ * Example use:
+ * @code
+ * const char text[] = "/mixer/ch/3 ,f 0.75";
+ * char oscMessage[MAX_OSC_MESSAGE_SIZE];
+ * size_t oscMessageSize;
+ * OscTextParseMessage(text, sizeof(text) - 1, &oscMessageSize, oscMessage, sizeof(oscMessage));
+ * @endcode
+ *
+ * @param text Text to be parsed.
+ * @param textLength Length of the text.
+ * @param oscMessageSize Size of the serialised OSC message.
+ * @param destination Destination address of the serialised OSC message.
+ * @param destinationSize Size of the destination.
+ * @return Error code (0 if successful).
+ */
+OscError OscTextParseMessage(const char * const text, const size_t textLength, size_t * const oscMessageSize, char * const destination, const size_t destinationSize) {
+    *oscMessageSize = 0; // size will be 0 if function unsuccessful
+    TextReader textReader;
+    textReader.text = text;
+    textReader.textIndex = 0;
+    textReader.lineEnd = textLength;
+    OscFormatWriter textWriter;
+    OscFormatWriterInitialise(&textWriter, destination, destinationSize);
+    SkipWhitespace(&textReader);
+    const OscError oscError = ParseMessage(&textReader, &textWriter);
+    if (oscError == OscErrorMessageSizeTooLarge) {
+        return OscErrorDestinationTooSmall; // error: destination too small
+    }
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+    *oscMessageSize = textWriter.size;
+    return OscErrorNone;
+}
+
+/**
+ * @brief Formats a signed integer as decimal text.  The text is not null
+ * terminated.
+ *
+ * Example use:
+ * @code
+ * char text[MAX_OSC_TEXT_NUMBER_LENGTH];
+ * const size_t textLength = OscTextFormatInt64(-123, text);
+ * @endcode
+ *
+ * @param int64 Value.
+ * @param text Destination of at least MAX_OSC_TEXT_NUMBER_LENGTH characters.
+ * @return Length of the text.
+ */
+size_t OscTextFormatInt64(const int64_t int64, char * const text) {
+    if (int64 < 0) {
+        text[0] = '-';
+        return 1 + FormatUnsigned((uint64_t) (-(int64 + 1)) + 1, &text[1]);
+    }
+    return FormatUnsigned((uint64_t) int64, text);
+}
+
+/**
+ * @brief Formats a float32 as decimal text using the fewest significant digits
+ * that round-trip.
+ *
+ * For each number of significant digits, the decimal values either side of
+ * the float32 are converted back to float32 and the first that is equal to the
+ * float32 is used.  A value exactly halfway between two float32 values is
+ * accepted if it rounds to the float32, as it would when parsed.  The float32
+ * is formatted with 9 significant digits if double is not wider than float32.
+ * The text is not null terminated.
+ *
+ * Example use:
+ * @code
+ * char text[MAX_OSC_TEXT_NUMBER_LENGTH];
+ * const size_t textLength = OscTextFormatFloat32(0.75f, text);
+ * @endcode
+ *
+ * @param float32 Value.
+ * @param text Destination of at least MAX_OSC_TEXT_NUMBER_LENGTH characters.
+ * @return Length of the text.
+ */
+size_t OscTextFormatFloat32(const float float32, char * const text) {
+#if DBL_MANT_DIG < 53
+    return FormatStandardLibrary((double) float32, 9, text);
+#else
+    size_t textLength = 0;
+    if (float32 != float32) {
+        memcpy(text, "nan", 3);
+        return 3;
+    }
+    if (signbit(float32)) {
+        text[textLength++] = '-';
+    }
+    const float magnitude = fabsf(float32);
+    if (isinf(magnitude)) {
+        memcpy(&text[textLength], "inf", 3);
+        return textLength + 3;
+    }
+    if (magnitude == 0.0f) {
+        text[textLength++] = '0';
+        return textLength;
+    }
+
+    // Find fewest significant digits that round-trip
+    const double value = (double) magnitude;
+    const int exponent = (int) floor(log10(value));
+    uint64_t digits = 0;
+    int scale = 0; // value is approximately digits / 10^scale
+    unsigned int precision;
+    for (precision = 1; precision <= FLOAT32_MAX_DIGITS; precision++) {
+        scale = (int) precision - 1 - exponent;
+        const double scaled = (scale >= 0) ? (value * powersOfTen[scale]) : (value / powersOfTen[-scale]);
+        const uint64_t truncated = (uint64_t) scaled;
+        const uint64_t nearest = ((scaled - (double) truncated) < 0.5) ? truncated : (truncated + 1);
+        const uint64_t other = (nearest == truncated) ? (truncated + 1) : truncated;
+        if (IsFloat32Digits(nearest, scale, magnitude) == true) {
+            digits = nearest;
+            break;
+        }
+        if (IsFloat32Digits(other, scale, magnitude) == true) {
+            digits = other;
+            break;
+        }
+        digits = nearest;
+    }
+    while ((digits % 10) == 0) {
+        digits /= 10;
+        scale--;
+    }
+
+    // Write digits in fixed or scientific notation
+    char digitsText[20];
+    const int numberOfDigits = (int) FormatUnsigned(digits, digitsText);
+    const int decimalExponent = numberOfDigits - 1 - scale; // exponent of first digit
+    if ((decimalExponent >= 0) && (decimalExponent < FLOAT32_MAX_DIGITS)) {
+        if (decimalExponent >= (numberOfDigits - 1)) {
+            memcpy(&text[textLength], digitsText, numberOfDigits);
+            textLength += numberOfDigits;
+            int zeroIndex;
+            for (zeroIndex = numberOfDigits; zeroIndex <= decimalExponent; zeroIndex++) {
+                text[textLength++] = '0';
+            }
+        } else {
+            memcpy(&text[textLength], digitsText, decimalExponent + 1);
+            textLength += decimalExponent + 1;
+            text[textLength++] = '.';
+            memcpy(&text[textLength], &digitsText[decimalExponent + 1], numberOfDigits - (decimalExponent + 1));
+            textLength += numberOfDigits - (decimalExponent + 1);
+        }
+        return textLength;
+    }
+    if ((decimalExponent < 0) && (decimalExponent >= -5)) {
+        text[textLength++] = '0';
+        text[textLength++] = '.';
+        int zeroIndex;
+        for (zeroIndex = -1; zeroIndex > decimalExponent; zeroIndex--) {
+            text[textLength++] = '0';
+        }
+        memcpy(&text[textLength], digitsText, numberOfDigits);
+        return textLength + numberOfDigits;
+    }
+    text[textLength++] = digitsText[0];
+    if (numberOfDigits > 1) {
+        text[textLength++] = '.';
+        memcpy(&text[textLength], &digitsText[1], numberOfDigits - 1);
+        textLength += numberOfDigits - 1;
+    }
+    text[textLength++] = 'e';
+    textLength += OscTextFormatInt64(decimalExponent, &text[textLength]);
+    return textLength;
+#endif
+}
+
+/**
+ * @brief Formats a double as decimal text with 17 significant digits so that
+ * the text round-trips.  The decimal point is always a full stop regardless of
+ * the current locale.  The text is not null terminated.
+ *
+ * Example use:
+ * @code
+ * char text[MAX_OSC_TEXT_NUMBER_LENGTH];
+ * const size_t textLength = OscTextFormatDouble(0.1, text);
+ * @endcode
+ *
+ * @param double64 Value.
+ * @param text Destination of at least MAX_OSC_TEXT_NUMBER_LENGTH characters.
+ * @return Length of the text.
+ */
+size_t OscTextFormatDouble(const double double64, char * const text) {
+    return FormatStandardLibrary(double64, 17, text);
+}
+
+/**
+ * @brief Formats an OSC time tag as the hexadecimal seconds and fraction
+ * separated by a full stop, for example: 83AA7E80.80000000.  The text is not
+ * null terminated.
+ *
+ * Example use:
+ * @code
+ * char text[MAX_OSC_TEXT_NUMBER_LENGTH];
+ * const size_t textLength = OscTextFormatTimeTag(oscTimeTag, text);
+ * @endcode
+ *
+ * @param oscTimeTag OSC time tag.
+ * @param text Destination of at least MAX_OSC_TEXT_NUMBER_LENGTH characters.
+ * @return Length of the text.
+ */
+size_t OscTextFormatTimeTag(const OscTimeTag oscTimeTag, char * const text) {
+    unsigned int textIndex;
+    for (textIndex = 0; textIndex < 8; textIndex++) {
+        text[textIndex] = oscFormatHexadecimalDigits[(oscTimeTag.value >> (60 - (4 * textIndex))) & 0xF];
+        text[textIndex + 9] = oscFormatHexadecimalDigits[(oscTimeTag.value >> (28 - (4 * textIndex))) & 0xF];
+    }
+    text[8] = '.';
+    return TIME_TAG_TEXT_LENGTH;
+}
+
+/**
+ * @brief Parses decimal text as an integer.  Digits are accumulated directly
+ * rather than using the standard library.
+ *
+ * Example use:
+ * @code
+ * int64_t int64;
+ * if (OscTextParseInt64("-123", 4, INT32_MIN, INT32_MAX, &int64) == true) {
+ *     printf("%d", (int) int64);
+ * }
+ * @endcode
+ *
+ * @param text Text to be parsed.
+ * @param textLength Length of the text.
+ * @param minimum Minimum value.
+ * @param maximum Maximum value.
+ * @param int64 Value.
+ * @return True if the text is an integer within the range.
+ */
+bool OscTextParseInt64(const char * const text, const size_t textLength, const int64_t minimum, const int64_t maximum, int64_t * const int64) {
+    *int64 = 0;
+    size_t textIndex = 0;
+    bool isNegative = false;
+    if ((textLength > 0) && ((text[0] == '-') || (text[0] == '+'))) {
+        isNegative = text[0] == '-';
+        textIndex++;
+    }
+    if (textIndex == textLength) {
+        return false; // no digits
+    }
+    uint64_t magnitude = 0;
+    while (textIndex < textLength) {
+        const unsigned int digit = (unsigned int) (unsigned char) text[textIndex] - '0';
+        if (digit > 9) {
+            return false;
+        }
+        if (magnitude > ((UINT64_MAX - digit) / 10)) {
+            return false; // overflow
+        }
+        magnitude = (magnitude * 10) + digit;
+        textIndex++;
+    }
+    if (isNegative == true) {
+        if ((magnitude != 0) && ((magnitude - 1) > (uint64_t) (-(minimum + 1)))) {
+            return false; // less than minimum
+        }
+        *int64 = (magnitude == 0) ? 0 : (-(int64_t) (magnitude - 1) - 1);
+    } else {
+        if (magnitude > (uint64_t) maximum) {
+            return false; // greater than maximum
+        }
+        *int64 = (int64_t) magnitude;
+    }
+    return true;
+}
+
+/**
+ * @brief Parses decimal text as a float32.
+ *
+ * A number with a mantissa and power of ten that are both exactly
+ * representable as a float32 is converted with a single correctly rounded
+ * multiplication or division.  Other numbers such as those with many
+ * significant digits, large exponents, inf, or nan are parsed by the standard
+ * library.  The decimal point must be a full stop regardless of the current
+ * locale.
+ *
+ * Example use:
+ * @code
+ * float float32;
+ * OscTextParseFloat32("0.75", 4, &float32);
+ * @endcode
+ *
+ * @param text Text to be parsed.
+ * @param textLength Length of the text.
+ * @param float32 Value.
+ * @return True if the text is a number within the range of a float32.
+ */
+bool OscTextParseFloat32(const char * const text, const size_t textLength, float * const float32) {
+
+    // Fast path
+    bool isNegative;
+    uint64_t mantissa;
+    int exponent;
+    if (ParseDecimal(text, textLength, &isNegative, &mantissa, &exponent) == true) {
+        if ((mantissa == 0) || ((mantissa <= FLOAT32_EXACT_MANTISSA_LIMIT) && (exponent >= -FLOAT32_EXACT_POWER_OF_TEN_LIMIT) && (exponent <= FLOAT32_EXACT_POWER_OF_TEN_LIMIT))) {
+            float value = (float) mantissa;
+            if (mantissa != 0) {
+                value = (exponent < 0) ? (value / float32PowersOfTen[-exponent]) : (value * float32PowersOfTen[exponent]);
+            }
+            *float32 = (isNegative == true) ? -value : value;
+            return true;
+        }
+    }
+
+    // Standard library
+    char number[MAX_OSC_TEXT_NUMBER_LENGTH];
+    if (CopyNumber(text, textLength, number) == false) {
+        return false;
+    }
+    char * end;
+    errno = 0;
+    *float32 = strtof(number, &end);
+    if ((end == number) || (*end != '\0')) {
+        return false;
+    }
+    if ((errno == ERANGE) && (isinf(*float32))) {
+        return false; // out of range
+    }
+    return true;
+}
+
+/**
+ * @brief Parses decimal text as a double.  Uses the same method as
+ * OscTextParseFloat32 with the limits of a double.  The standard library is
+ * always used if double is not IEEE 754 double precision.
+ *
+ * Example use:
+ * @code
+ * double double64;
+ * OscTextParseDouble("0.1", 3, &double64);
+ * @endcode
+ *
+ * @param text Text to be parsed.
+ * @param textLength Length of the text.
+ * @param double64 Value.
+ * @return True if the text is a number within the range of a double.
+ */
+bool OscTextParseDouble(const char * const text, const size_t textLength, double * const double64) {
+
+    // Fast path
+#if DBL_MANT_DIG == 53
+    bool isNegative;
+    uint64_t mantissa;
+    int exponent;
+    if (ParseDecimal(text, textLength, &isNegative, &mantissa, &exponent) == true) {
+        if ((mantissa == 0) || ((mantissa <= DOUBLE_EXACT_MANTISSA_LIMIT) && (exponent >= -DOUBLE_EXACT_POWER_OF_TEN_LIMIT) && (exponent <= DOUBLE_EXACT_POWER_OF_TEN_LIMIT))) {
+            double value = (double) mantissa;
+            if (mantissa != 0) {
+                value = (exponent < 0) ? (value / powersOfTen[-exponent]) : (value * powersOfTen[exponent]);
+            }
+            *double64 = (isNegative == true) ? -value : value;
+            return true;
+        }
+    }
+#endif
+
+    // Standard library
+    char number[MAX_OSC_TEXT_NUMBER_LENGTH];
+    if (CopyNumber(text, textLength, number) == false) {
+        return false;
+    }
+    char * end;
+    errno = 0;
+    *double64 = strtod(number, &end);
+    if ((end == number) || (*end != '\0')) {
+        return false;
+    }
+    if ((errno == ERANGE) && (isinf(*double64))) {
+        return false; // out of range
+    }
+    return true;
+}
+
+/**
+ * @brief Parses an OSC time tag written as the hexadecimal seconds and
+ * fraction separated by a full stop, for example: 83AA7E80.80000000.
+ *
+ * Example use:
+ * @code
+ * OscTimeTag oscTimeTag;
+ * OscTextParseTimeTag("83AA7E80.80000000", 17, &oscTimeTag);
+ * @endcode
+ *
+ * @param text Text to be parsed.
+ * @param textLength Length of the text.
+ * @param oscTimeTag OSC time tag.
+ * @return True if the text is an OSC time tag.
+ */
+bool OscTextParseTimeTag(const char * const text, const size_t textLength, OscTimeTag * const oscTimeTag) {
+    if ((textLength != TIME_TAG_TEXT_LENGTH) || (text[8] != '.')) {
+        return false;
+    }
+    uint64_t value = 0;
+    unsigned int textIndex;
+    for (textIndex = 0; textIndex < TIME_TAG_TEXT_LENGTH; textIndex++) {
+        if (textIndex == 8) {
+            continue; // skip full stop
+        }
+        const unsigned int digit = OscFormatGetHexadecimalValue(text[textIndex]);
+        if (digit > 0xF) {
+            return false;
+        }
+        value = (value << 4) | digit;
+    }
+    oscTimeTag->value = value;
+    return true;
+}
+
+/**
+ * @brief Recursively formats OSC contents as text.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textWriter Text writer structure.
+ * @param oscTimeTag OSC time tag of the bundle containing the OSC contents.
+ * Must be NULL if the contents is not within an OSC bundle.
+ * @param oscContents OSC contents.
+ * @param contentsSize Size of the OSC contents.
+ * @return Error code (0 if successful).
+ */
+static OscError FormatContents(OscFormatWriter * const textWriter, const OscTimeTag * const oscTimeTag, const char * const oscContents, const size_t contentsSize) {
+    if (contentsSize == 0) {
+        return OscErrorContentsEmpty; // error: contents empty
+    }
+
+    // Contents is an OSC message
+    if (OscContentsIsMessage(oscContents) == true) {
+        if (oscTimeTag != NULL) {
+            WriteTimeTag(textWriter, *oscTimeTag);
+            OscFormatWriterWrite(textWriter, " ", 1);
+        }
+        const OscError oscError = FormatMessage(textWriter, oscContents, contentsSize);
+        if (oscError != OscErrorNone) {
+            return oscError;
+        }
+        OscFormatWriterWrite(textWriter, "\n", 1);
+        return OscErrorNone;
+    }
+
+    // Contents is an OSC bundle
+    if (OscContentsIsBundle(oscContents) == true) {
+        if (contentsSize < MIN_OSC_BUNDLE_SIZE) {
+            return OscErrorBundleSizeTooSmall; // error: too few bytes to contain bundle
+        }
+        if ((contentsSize % 4) != 0) {
+            return OscErrorSizeIsNotMultipleOfFour; // error: size not multiple of 4
+        }
+        size_t contentsIndex = sizeof (OSC_BUNDLE_HEADER);
+        const OscArgument64 bundleTimeTag = OscFormatReadArgument64(&oscContents[contentsIndex]);
+        OscTimeTag bundleOscTimeTag;
+        bundleOscTimeTag.value = bundleTimeTag.int64;
+        contentsIndex += sizeof (OscTimeTag);
+        while (contentsIndex < contentsSize) {
+            if ((contentsIndex + sizeof (OscArgument32)) > contentsSize) {
+                return OscErrorBundleElementNotAvailable; // error: too few bytes to contain bundle element size
+            }
+            const OscArgument32 elementSize = OscFormatReadArgument32(&oscContents[contentsIndex]);
+            contentsIndex += sizeof (OscArgument32);
+            if (elementSize.int32 < 0) {
+                return OscErrorNegativeBundleElementSize; // error: size cannot be negative
+            }
+            if ((elementSize.int32 % 4) != 0) {
+                return OscErrorSizeIsNotMultipleOfFour; // error: size not multiple of 4
+            }
+            if ((contentsIndex + elementSize.int32) > contentsSize) {
+                return OscErrorInvalidElementSize; // error: too few bytes for indicated size
+            }
+            const OscError oscError = FormatContents(textWriter, &bundleOscTimeTag, &oscContents[contentsIndex], elementSize.int32); // recursive formatting
+            if (oscError != OscErrorNone) {
+                return oscError;
+            }
+            contentsIndex += elementSize.int32;
+        }
+        return OscErrorNone;
+    }
+
+    return OscErrorInvalidContents; // error: invalid or uninitialised contents
+}
+
+/**
+ * @brief Formats a serialised OSC message as text, excluding the new line
+ * character.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textWriter Text writer structure.
+ * @param source Serialised OSC message.
+ * @param numberOfBytes Size of the serialised OSC message.
+ * @return Error code (0 if successful).
+ */
+static OscError FormatMessage(OscFormatWriter * const textWriter, const char * const source, const size_t numberOfBytes) {
+    OscFormatMessage oscFormatMessage;
+    OscError oscError = OscFormatMessageInitialise(&oscFormatMessage, source, numberOfBytes);
+    if (oscError != OscErrorNone) {
+        return oscError;
+    }
+
+    // OSC address pattern and OSC type tag string
+    WriteAddressPattern(textWriter, oscFormatMessage.oscAddressPattern, oscFormatMessage.oscAddressPatternLength);
+    OscFormatWriterWrite(textWriter, " ", 1);
+    OscFormatWriterWrite(textWriter, oscFormatMessage.oscTypeTagString, oscFormatMessage.oscTypeTagStringLength);
+
+    // Arguments
+    while (OscFormatMessageIsArgumentAvailable(&oscFormatMessage) == true) {
+        OscFormatArgument argument;
+        oscError = OscFormatMessageGetArgument(&oscFormatMessage, &argument);
+        if (oscError != OscErrorNone) {
+            return oscError;
+        }
+        switch (argument.typeTag) {
+            case OscTypeTagTrue:
+            case OscTypeTagFalse:
+            case OscTypeTagNil:
+            case OscTypeTagInfinitum:
+            case OscTypeTagBeginArray:
+            case OscTypeTagEndArray:
+                continue; // no data
+            default:
+                break;
+        }
+        char text[MAX_OSC_TEXT_NUMBER_LENGTH];
+        size_t textLength = 0;
+        OscFormatWriterWrite(textWriter, " ", 1);
+        switch (argument.typeTag) {
+            case OscTypeTagInt32:
+                textLength = OscTextFormatInt64(OscFormatReadArgument32(argument.data).int32, text);
+                break;
+            case OscTypeTagFloat32:
+                textLength = OscTextFormatFloat32(OscFormatReadArgument32(argument.data).float32, text);
+                break;
+            case OscTypeTagCharacter:
+                WriteQuoted(textWriter, &argument.data[3], 1, '\'');
+                break;
+            case OscTypeTagRgbaColour:
+            case OscTypeTagMidiMessage:
+            case OscTypeTagBlob:
+                WriteHexadecimal(textWriter, argument.data, argument.size);
+                break;
+            case OscTypeTagInt64:
+                textLength = OscTextFormatInt64((int64_t) OscFormatReadArgument64(argument.data).int64, text);
+                break;
+            case OscTypeTagTimeTag:
+            {
+                OscTimeTag oscTimeTag;
+                oscTimeTag.value = OscFormatReadArgument64(argument.data).int64;
+                WriteTimeTag(textWriter, oscTimeTag);
+                break;
+            }
+            case OscTypeTagDouble:
+                textLength = OscTextFormatDouble((double) OscFormatReadArgument64(argument.data).double64, text);
+                break;
+            case OscTypeTagString:
+            case OscTypeTagAlternateString:
+            default:
+                WriteQuoted(textWriter, argument.data, argument.size, '"');
+                break;
+        }
+        OscFormatWriterWrite(textWriter, text, textLength);
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Writes an OSC address pattern.  Whitespace, backslashes, and
+ * characters that are not printable are written as \xHH so that the OSC
+ * address pattern is a single token.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textWriter Text writer structure.
+ * @param source OSC address pattern.
+ * @param numberOfBytes Length of the OSC address pattern.
+ */
+static void WriteAddressPattern(OscFormatWriter * const textWriter, const char * const source, const size_t numberOfBytes) {
+    size_t runStart = 0; // start of characters that do not require escaping
+    size_t sourceIndex;
+    for (sourceIndex = 0; sourceIndex < numberOfBytes; sourceIndex++) {
+        const unsigned char character = (unsigned char) source[sourceIndex];
+        if ((character > ' ') && (character <= '~') && (character != '\\')) {
+            continue;
+        }
+        OscFormatWriterWrite(textWriter, &source[runStart], sourceIndex - runStart);
+        runStart = sourceIndex + 1;
+        const char escaped[4] = {'\\', 'x', oscFormatHexadecimalDigits[character >> 4], oscFormatHexadecimalDigits[character & 0xF]};
+        OscFormatWriterWrite(textWriter, escaped, sizeof (escaped));
+    }
+    OscFormatWriterWrite(textWriter, &source[runStart], numberOfBytes - runStart);
+}
+
+/**
+ * @brief Writes a string within quotes.  A quote or backslash is preceded by a
+ * backslash and any character that is not printable is written as \xHH.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textWriter Text writer structure.
+ * @param source String.
+ * @param numberOfBytes Length of the string.
+ * @param quote Quote character.
+ */
+static void WriteQuoted(OscFormatWriter * const textWriter, const char * const source, const size_t numberOfBytes, const char quote) {
+    OscFormatWriterWrite(textWriter, &quote, 1);
+    size_t runStart = 0; // start of characters that do not require escaping
+    size_t sourceIndex;
+    for (sourceIndex = 0; sourceIndex < numberOfBytes; sourceIndex++) {
+        const unsigned char character = (unsigned char) source[sourceIndex];
+        if ((character >= ' ') && (character <= '~') && (character != (unsigned char) quote) && (character != '\\')) {
+            continue;
+        }
+        OscFormatWriterWrite(textWriter, &source[runStart], sourceIndex - runStart);
+        runStart = sourceIndex + 1;
+        if ((character >= ' ') && (character <= '~')) {
+            const char escaped[2] = {'\\', (char) character};
+            OscFormatWriterWrite(textWriter, escaped, sizeof (escaped));
+        } else {
+            const char escaped[4] = {'\\', 'x', oscFormatHexadecimalDigits[character >> 4], oscFormatHexadecimalDigits[character & 0xF]};
+            OscFormatWriterWrite(textWriter, escaped, sizeof (escaped));
+        }
+    }
+    OscFormatWriterWrite(textWriter, &source[runStart], numberOfBytes - runStart);
+    OscFormatWriterWrite(textWriter, &quote, 1);
+}
+
+/**
+ * @brief Writes bytes as 0x followed by two hexadecimal digits for each byte.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textWriter Text writer structure.
+ * @param source Bytes.
+ * @param numberOfBytes Number of bytes.
+ */
+static void WriteHexadecimal(OscFormatWriter * const textWriter, const char * const source, const size_t numberOfBytes) {
+    OscFormatWriterWrite(textWriter, "0x", 2);
+    if ((textWriter->isFull == true) || ((textWriter->size + (2 * numberOfBytes)) > textWriter->destinationSize)) {
+        textWriter->isFull = true;
+        return;
+    }
+    char * destination = &textWriter->destination[textWriter->size];
+    size_t sourceIndex;
+    for (sourceIndex = 0; sourceIndex < numberOfBytes; sourceIndex++) {
+        const unsigned char byte = (unsigned char) source[sourceIndex];
+        *destination++ = oscFormatHexadecimalDigits[byte >> 4];
+        *destination++ = oscFormatHexadecimalDigits[byte & 0xF];
+    }
+    textWriter->size += 2 * numberOfBytes;
+}
+
+/**
+ * @brief Writes an OSC time tag as the hexadecimal seconds and fraction
+ * separated by a full stop, for example: 83AA7E80.80000000.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textWriter Text writer structure.
+ * @param oscTimeTag OSC time tag.
+ */
+static void WriteTimeTag(OscFormatWriter * const textWriter, const OscTimeTag oscTimeTag) {
+    char text[TIME_TAG_TEXT_LENGTH];
+    OscFormatWriterWrite(textWriter, text, OscTextFormatTimeTag(oscTimeTag, text));
+}
+
+/**
+ * @brief Formats an unsigned integer as decimal text.  Digits are written two
+ * at a time using a lookup table.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param value Value.
+ * @param text Destination of the text.
+ * @return Length of the text.
+ */
+static size_t FormatUnsigned(uint64_t value, char * const text) {
+    char buffer[20];
+    size_t bufferIndex = sizeof (buffer);
+    while (value >= 100) {
+        const unsigned int pair = (unsigned int) (value % 100) * 2;
+        value /= 100;
+        buffer[--bufferIndex] = twoDigits[pair + 1];
+        buffer[--bufferIndex] = twoDigits[pair];
+    }
+    if (value >= 10) {
+        const unsigned int pair = (unsigned int) value * 2;
+        buffer[--bufferIndex] = twoDigits[pair + 1];
+        buffer[--bufferIndex] = twoDigits[pair];
+    } else {
+        buffer[--bufferIndex] = (char) ('0' + value);
+    }
+    memcpy(text, &buffer[bufferIndex], sizeof (buffer) - bufferIndex);
+    return sizeof (buffer) - bufferIndex;
+}
+
+/**
+ * @brief Formats a value as decimal text using the standard library with the
+ * specified number of significant digits.  The decimal point of the current
+ * locale is replaced with a full stop.  The text is not null terminated.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param value Value.
+ * @param precision Number of significant digits.
+ * @param text Destination of at least MAX_OSC_TEXT_NUMBER_LENGTH characters.
+ * @return Length of the text.
+ */
+static size_t FormatStandardLibrary(const double value, const int precision, char * const text) {
+    char buffer[MAX_OSC_TEXT_NUMBER_LENGTH + 1]; // snprintf writes terminating null character
+    const size_t bufferLength = (size_t) snprintf(buffer, sizeof (buffer), "%.*g", precision, value);
+    const char * const decimalPoint = localeconv()->decimal_point;
+    const size_t decimalPointLength = strlen(decimalPoint);
+    size_t textLength = 0;
+    size_t bufferIndex = 0;
+    while (bufferIndex < bufferLength) {
+        if ((decimalPointLength > 0) && (strncmp(&buffer[bufferIndex], decimalPoint, decimalPointLength) == 0)) {
+            text[textLength++] = '.';
+            bufferIndex += decimalPointLength;
+            continue;
+        }
+        text[textLength++] = buffer[bufferIndex++];
+    }
+    return textLength;
+}
+
+#if DBL_MANT_DIG >= 53
+
+/**
+ * @brief Returns true if the decimal value digits / 10^scale converts to the
+ * float32.  The decimal value is evaluated as a double, which is wider than
+ * float32, and then converted to float32.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param digits Significant digits.
+ * @param scale Power of ten by which the digits are divided.
+ * @param float32 Float32.
+ * @return True if the decimal value converts to the float32.
+ */
+static bool IsFloat32Digits(const uint64_t digits, const int scale, const float float32) {
+    const double candidate = (scale >= 0) ? ((double) digits / powersOfTen[scale]) : ((double) digits * powersOfTen[-scale]);
+    return (float) candidate == float32;
+}
+
+#endif
+
+/**
+ * @brief Writes a placeholder for the size of an OSC bundle followed by the
+ * OSC bundle header and OSC time tag.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textWriter Text writer structure.
+ * @param oscTimeTag OSC time tag.
+ */
+static void WriteBundleHeader(OscFormatWriter * const textWriter, const OscTimeTag oscTimeTag) {
+    char bundleHeader[sizeof (OscArgument32) + MIN_OSC_BUNDLE_SIZE];
+    OscFormatWriteInt32(bundleHeader, 0); // written by caller
+    memcpy(&bundleHeader[sizeof (OscArgument32)], OSC_BUNDLE_HEADER, sizeof (OSC_BUNDLE_HEADER));
+    OscFormatWriteInt32(&bundleHeader[sizeof (OscArgument32) + sizeof (OSC_BUNDLE_HEADER)], (int32_t) (oscTimeTag.value >> 32));
+    OscFormatWriteInt32(&bundleHeader[sizeof (OscArgument32) + sizeof (OSC_BUNDLE_HEADER) + sizeof (OscArgument32)], (int32_t) oscTimeTag.value);
+    OscFormatWriterWrite(textWriter, bundleHeader, sizeof (bundleHeader));
+}
+
+/**
+ * @brief Parses the OSC address pattern, OSC type tag string, and arguments of
+ * a line of text and writes the serialised OSC message.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textReader Text reader structure.
+ * @param textWriter Text writer structure.
+ * @return Error code (0 if successful).
+ */
+static OscError ParseMessage(TextReader * const textReader, OscFormatWriter * const textWriter) {
+    const char * const text = textReader->text;
+
+    // OSC address pattern
+    if ((textReader->textIndex == textReader->lineEnd) || (text[textReader->textIndex] != '/')) {
+        return OscErrorInvalidTextAddressPattern; // error: OSC address pattern must start with '/'
+    }
+    if (ParseAddressPattern(textReader, textWriter) == false) {
+        return OscErrorInvalidTextAddressPattern; // error: invalid escape sequence
+    }
+    OscFormatWriterWrite(textWriter, "", 1);
+    OscFormatWriterWritePadding(textWriter);
+    SkipWhitespace(textReader);
+
+    // OSC type tag string
+    const char * typeTagString = ",";
+    size_t typeTagStringLength = 1;
+    if (textReader->textIndex < textReader->lineEnd) {
+        if (text[textReader->textIndex] != ',') {
+            return OscErrorInvalidTextTypeTagString; // error: OSC type tag string must start with ','
+        }
+        const size_t tokenEnd = GetTokenEnd(textReader);
+        typeTagString = &text[textReader->textIndex];
+        typeTagStringLength = tokenEnd - textReader->textIndex;
+        textReader->textIndex = tokenEnd;
+    }
+    OscFormatWriterWrite(textWriter, typeTagString, typeTagStringLength);
+    OscFormatWriterWrite(textWriter, "", 1);
+    OscFormatWriterWritePadding(textWriter);
+
+    // Arguments
+    size_t typeTagIndex;
+    for (typeTagIndex = 1; typeTagIndex < typeTagStringLength; typeTagIndex++) { // skip comma
+        switch (typeTagString[typeTagIndex]) {
+            case OscTypeTagInt32:
+            case OscTypeTagFloat32:
+            case OscTypeTagString:
+            case OscTypeTagBlob:
+            case OscTypeTagInt64:
+            case OscTypeTagTimeTag:
+            case OscTypeTagDouble:
+            case OscTypeTagAlternateString:
+            case OscTypeTagCharacter:
+            case OscTypeTagRgbaColour:
+            case OscTypeTagMidiMessage:
+                break;
+            case OscTypeTagTrue:
+            case OscTypeTagFalse:
+            case OscTypeTagNil:
+            case OscTypeTagInfinitum:
+            case OscTypeTagBeginArray:
+            case OscTypeTagEndArray:
+                continue; // no data
+            default:
+                return OscErrorUnknownTypeTag; // error: type tag string contains unknown type tag
+        }
+        SkipWhitespace(textReader);
+        if (textReader->textIndex == textReader->lineEnd) {
+            return OscErrorTooFewTextArguments; // error: fewer arguments than type tags
+        }
+        const size_t tokenEnd = GetTokenEnd(textReader);
+        const char * const token = &text[textReader->textIndex];
+        const size_t tokenLength = tokenEnd - textReader->textIndex;
+        char argument[sizeof (OscArgument64)];
+        bool isValid;
+        switch (typeTagString[typeTagIndex]) {
+            case OscTypeTagInt32:
+            {
+                int64_t int64;
+                isValid = OscTextParseInt64(token, tokenLength, INT32_MIN, INT32_MAX, &int64);
+                textReader->textIndex = tokenEnd;
+                OscFormatWriteInt32(argument, (int32_t) int64);
+                OscFormatWriterWrite(textWriter, argument, sizeof (OscArgument32));
+                break;
+            }
+            case OscTypeTagFloat32:
+            {
+                OscArgument32 oscArgument32;
+                isValid = OscTextParseFloat32(token, tokenLength, &oscArgument32.float32);
+                textReader->textIndex = tokenEnd;
+                OscFormatWriteInt32(argument, oscArgument32.int32);
+                OscFormatWriterWrite(textWriter, argument, sizeof (OscArgument32));
+                break;
+            }
+            case OscTypeTagInt64:
+            {
+                int64_t int64;
+                isValid = OscTextParseInt64(token, tokenLength, INT64_MIN, INT64_MAX, &int64);
+                textReader->textIndex = tokenEnd;
+                OscFormatWriteInt32(argument, (int32_t) ((uint64_t) int64 >> 32));
+                OscFormatWriteInt32(&argument[sizeof (OscArgument32)], (int32_t) int64);
+                OscFormatWriterWrite(textWriter, argument, sizeof (OscArgument64));
+                break;
+            }
+            case OscTypeTagTimeTag:
+            {
+                OscTimeTag oscTimeTag;
+                oscTimeTag.value = 0;
+                isValid = OscTextParseTimeTag(token, tokenLength, &oscTimeTag);
+                textReader->textIndex = tokenEnd;
+                OscFormatWriteInt32(argument, (int32_t) (oscTimeTag.value >> 32));
+                OscFormatWriteInt32(&argument[sizeof (OscArgument32)], (int32_t) oscTimeTag.value);
+                OscFormatWriterWrite(textWriter, argument, sizeof (OscArgument64));
+                break;
+            }
+            case OscTypeTagDouble:
+            {
+                double double64;
+                isValid = OscTextParseDouble(token, tokenLength, &double64);
+                textReader->textIndex = tokenEnd;
+                OscArgument64 oscArgument64;
+                oscArgument64.double64 = (Double64) double64;
+                OscFormatWriteInt32(argument, (int32_t) (oscArgument64.int64 >> 32));
+                OscFormatWriteInt32(&argument[sizeof (OscArgument32)], (int32_t) oscArgument64.int64);
+                OscFormatWriterWrite(textWriter, argument, sizeof (OscArgument64));
+                break;
+            }
+            case OscTypeTagString:
+            case OscTypeTagAlternateString:
+            {
+                const size_t stringStart = textWriter->size;
+                isValid = ParseQuoted(textReader, textWriter, '"');
+                if ((textWriter->isFull == false) && (memchr(&textWriter->destination[stringStart], '\0', textWriter->size - stringStart) != NULL)) {
+                    isValid = false; // string cannot contain null character
+                }
+                OscFormatWriterWrite(textWriter, "", 1);
+                OscFormatWriterWritePadding(textWriter);
+                break;
+            }
+            case OscTypeTagCharacter:
+            {
+                OscFormatWriterWrite(textWriter, "\0\0\0", 3);
+                const size_t characterStart = textWriter->size;
+                isValid = ParseQuoted(textReader, textWriter, '\'');
+                if ((textWriter->isFull == false) && ((textWriter->size - characterStart) != 1)) {
+                    isValid = false; // must be single character
+                }
+                break;
+            }
+            case OscTypeTagRgbaColour:
+            case OscTypeTagMidiMessage:
+            {
+                size_t numberOfBytes;
+                isValid = ParseHexadecimal(textReader, textWriter, &numberOfBytes);
+                if (numberOfBytes != sizeof (OscArgument32)) {
+                    isValid = false; // must be 4 bytes
+                }
+                break;
+            }
+            case OscTypeTagBlob:
+            default:
+            {
+                const size_t blobSizeIndex = textWriter->size;
+                OscFormatWriteInt32(argument, 0); // written below
+                OscFormatWriterWrite(textWriter, argument, sizeof (OscArgument32));
+                size_t numberOfBytes;
+                isValid = ParseHexadecimal(textReader, textWriter, &numberOfBytes);
+                if (textWriter->isFull == false) {
+                    OscFormatWriteInt32(&textWriter->destination[blobSizeIndex], (int32_t) numberOfBytes);
+                }
+                OscFormatWriterWritePadding(textWriter);
+                break;
+            }
+        }
+        if (isValid == false) {
+            return OscErrorInvalidTextArgument; // error: argument invalid for type tag
+        }
+    }
+    SkipWhitespace(textReader);
+    if (textReader->textIndex != textReader->lineEnd) {
+        return OscErrorTooManyTextArguments; // error: more arguments than type tags
+    }
+    if (textWriter->isFull == true) {
+        return OscErrorMessageSizeTooLarge; // error: message too large
+    }
+    return OscErrorNone;
+}
+
+/**
+ * @brief Returns true if the character separates tokens.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param character Character.
+ * @return True if the character separates tokens.
+ */
+static bool IsWhitespace(const char character) {
+    return (character == ' ') || (character == '\t') || (character == '\r');
+}
+
+/**
+ * @brief Advances the text reader past any whitespace.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textReader Text reader structure.
+ */
+static void SkipWhitespace(TextReader * const textReader) {
+    while ((textReader->textIndex < textReader->lineEnd) && (IsWhitespace(textReader->text[textReader->textIndex]) == true)) {
+        textReader->textIndex++;
+    }
+}
+
+/**
+ * @brief Returns the index of the end of the token at the text index.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textReader Text reader structure.
+ * @return Index of the whitespace or line end following the token.
+ */
+static size_t GetTokenEnd(const TextReader * const textReader) {
+    size_t textIndex = textReader->textIndex;
+    while ((textIndex < textReader->lineEnd) && (IsWhitespace(textReader->text[textIndex]) == false)) {
+        textIndex++;
+    }
+    return textIndex;
+}
+
+/**
+ * @brief Parses an OSC address pattern.  \xHH is parsed as a hexadecimal
+ * character.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textReader Text reader structure.
+ * @param textWriter Text writer structure.
+ * @return True if successful.
+ */
+static bool ParseAddressPattern(TextReader * const textReader, OscFormatWriter * const textWriter) {
+    const char * const text = textReader->text;
+    const size_t tokenEnd = GetTokenEnd(textReader);
+    size_t textIndex = textReader->textIndex;
+    size_t runStart = textIndex; // start of characters that are not escaped
+    while (textIndex < tokenEnd) {
+        if (text[textIndex] != '\\') {
+            textIndex++;
+            continue;
+        }
+        OscFormatWriterWrite(textWriter, &text[runStart], textIndex - runStart);
+        if (((textIndex + 4) > tokenEnd) || (text[textIndex + 1] != 'x')) {
+            return false; // unknown escape sequence
+        }
+        const unsigned int high = OscFormatGetHexadecimalValue(text[textIndex + 2]);
+        const unsigned int low = OscFormatGetHexadecimalValue(text[textIndex + 3]);
+        if ((high > 0xF) || (low > 0xF) || ((high | low) == 0)) {
+            return false; // invalid hexadecimal character or null character
+        }
+        const char character = (char) ((high << 4) | low);
+        OscFormatWriterWrite(textWriter, &character, 1);
+        textIndex += 4;
+        runStart = textIndex;
+    }
+    OscFormatWriterWrite(textWriter, &text[runStart], tokenEnd - runStart);
+    textReader->textIndex = tokenEnd;
+    return true;
+}
+
+/**
+ * @brief Parses a string within quotes.  A quote or backslash preceded by a
+ * backslash is parsed as that character, \xHH as a hexadecimal character, and
+ * \n, \r, and \t as the corresponding control characters.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textReader Text reader structure.
+ * @param textWriter Text writer structure.
+ * @param quote Quote character.
+ * @return True if successful.
+ */
+static bool ParseQuoted(TextReader * const textReader, OscFormatWriter * const textWriter, const char quote) {
+    const char * const text = textReader->text;
+    size_t textIndex = textReader->textIndex;
+    if ((textIndex == textReader->lineEnd) || (text[textIndex] != quote)) {
+        return false;
+    }
+    textIndex++;
+    size_t runStart = textIndex; // start of characters that are not escaped
+    while (true) {
+        if (textIndex == textReader->lineEnd) {
+            return false; // no closing quote
+        }
+        if (text[textIndex] == quote) {
+            break;
+        }
+        if (text[textIndex] != '\\') {
+            textIndex++;
+            continue;
+        }
+        OscFormatWriterWrite(textWriter, &text[runStart], textIndex - runStart);
+        textIndex++;
+        if (textIndex == textReader->lineEnd) {
+            return false;
+        }
+        char character = text[textIndex++];
+        switch (character) {
+            case '\\':
+            case '"':
+            case '\'':
+                break;
+            case 'n':
+                character = '\n';
+                break;
+            case 'r':
+                character = '\r';
+                break;
+            case 't':
+                character = '\t';
+                break;
+            case 'x':
+            {
+                if ((textIndex + 2) > textReader->lineEnd) {
+                    return false;
+                }
+                const unsigned int high = OscFormatGetHexadecimalValue(text[textIndex]);
+                const unsigned int low = OscFormatGetHexadecimalValue(text[textIndex + 1]);
+                if ((high > 0xF) || (low > 0xF)) {
+                    return false;
+                }
+                character = (char) ((high << 4) | low);
+                textIndex += 2;
+                break;
+            }
+            default:
+                return false; // unknown escape sequence
+        }
+        OscFormatWriterWrite(textWriter, &character, 1);
+        runStart = textIndex;
+    }
+    OscFormatWriterWrite(textWriter, &text[runStart], textIndex - runStart);
+    textIndex++; // skip closing quote
+    if ((textIndex < textReader->lineEnd) && (IsWhitespace(text[textIndex]) == false)) {
+        return false; // closing quote must end token
+    }
+    textReader->textIndex = textIndex;
+    return true;
+}
+
+/**
+ * @brief Parses bytes written as 0x followed by two hexadecimal digits for
+ * each byte.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param textReader Text reader structure.
+ * @param textWriter Text writer structure.
+ * @param numberOfBytes Number of bytes.
+ * @return True if successful.
+ */
+static bool ParseHexadecimal(TextReader * const textReader, OscFormatWriter * const textWriter, size_t * const numberOfBytes) {
+    *numberOfBytes = 0;
+    const char * const text = textReader->text;
+    const size_t tokenEnd = GetTokenEnd(textReader);
+    size_t textIndex = textReader->textIndex;
+    if (((tokenEnd - textIndex) < 2) || (text[textIndex] != '0') || ((text[textIndex + 1] != 'x') && (text[textIndex + 1] != 'X'))) {
+        return false;
+    }
+    textIndex += 2; // skip 0x
+    if (((tokenEnd - textIndex) % 2) != 0) {
+        return false; // must be two digits for each byte
+    }
+    *numberOfBytes = (tokenEnd - textIndex) / 2;
+    while (textIndex < tokenEnd) {
+        const unsigned int high = OscFormatGetHexadecimalValue(text[textIndex]);
+        const unsigned int low = OscFormatGetHexadecimalValue(text[textIndex + 1]);
+        if ((high > 0xF) || (low > 0xF)) {
+            return false;
+        }
+        const char byte = (char) ((high << 4) | low);
+        OscFormatWriterWrite(textWriter, &byte, 1);
+        textIndex += 2;
+    }
+    textReader->textIndex = tokenEnd;
+    return true;
+}
+
+/**
+ * @brief Parses a decimal number as a mantissa and a power of ten exponent.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param text Text to be parsed.
+ * @param textLength Length of the text.
+ * @param isNegative True if the number is negative.
+ * @param mantissa Significant digits.
+ * @param exponent Power of ten exponent.
+ * @return True if successful.  False if the text is not a decimal number or
+ * has too many significant digits.
+ */
+static bool ParseDecimal(const char * const text, const size_t textLength, bool * const isNegative, uint64_t * const mantissa, int * const exponent) {
+    size_t textIndex = 0;
+    *isNegative = false;
+    *mantissa = 0;
+    *exponent = 0;
+    if ((textLength > 0) && ((text[0] == '-') || (text[0] == '+'))) {
+        *isNegative = text[0] == '-';
+        textIndex++;
+    }
+
+    // Significant digits
+    unsigned int numberOfDigits = 0;
+    bool hasDigits = false;
+    bool isFraction = false;
+    while (textIndex < textLength) {
+        if ((text[textIndex] == '.') && (isFraction == false)) {
+            isFraction = true;
+            textIndex++;
+            continue;
+        }
+        const unsigned int digit = (unsigned int) (unsigned char) text[textIndex] - '0';
+        if (digit > 9) {
+            break;
+        }
+        hasDigits = true;
+        if ((*mantissa != 0) || (digit != 0)) {
+            if (++numberOfDigits > MAX_DECIMAL_DIGITS) {
+                return false; // too many significant digits
+            }
+            *mantissa = (*mantissa * 10) + digit;
+        }
+        if (isFraction == true) {
+            (*exponent)--;
+        }
+        textIndex++;
+    }
+    if (hasDigits == false) {
+        return false;
+    }
+
+    // Exponent
+    if ((textIndex < textLength) && ((text[textIndex] == 'e') || (text[textIndex] == 'E'))) {
+        textIndex++;
+        bool isExponentNegative = false;
+        if ((textIndex < textLength) && ((text[textIndex] == '-') || (text[textIndex] == '+'))) {
+            isExponentNegative = text[textIndex] == '-';
+            textIndex++;
+        }
+        if (textIndex == textLength) {
+            return false; // no digits
+        }
+        int exponentValue = 0;
+        while (textIndex < textLength) {
+            const unsigned int digit = (unsigned int) (unsigned char) text[textIndex] - '0';
+            if ((digit > 9) || (exponentValue > 9999)) {
+                return false;
+            }
+            exponentValue = (exponentValue * 10) + (int) digit;
+            textIndex++;
+        }
+        *exponent += (isExponentNegative == true) ? -exponentValue : exponentValue;
+    }
+    return textIndex == textLength;
+}
+
+/**
+ * @brief Copies a number as a null-terminated string for the standard library.
+ * A full stop is replaced with the decimal point of the current locale so that
+ * the number is parsed the same regardless of the locale.
+ *
+ * This is an internal function and cannot be called by the user application.
+ *
+ * @param text Text of the number.
+ * @param textLength Length of the text.
+ * @param number Destination of MAX_OSC_TEXT_NUMBER_LENGTH characters.
+ * @return True if successful.  False if the text is too long or contains the
+ * decimal point of the current locale.
+ */
+static bool CopyNumber(const char * const text, const size_t textLength, char * const number) {
+    const char * const decimalPoint = localeconv()->decimal_point;
+    const size_t decimalPointLength = strlen(decimalPoint);
+    size_t numberLength = 0;
+    size_t textIndex;
+    for (textIndex = 0; textIndex < textLength; textIndex++) {
+        const char character = text[textIndex];
+        if ((decimalPointLength > 0) && (character == decimalPoint[0]) && (character != '.')) {
+            return false; // decimal point of locale is not valid
+        }
+        if ((character == '.') && (decimalPointLength > 0)) {
+            if ((numberLength + decimalPointLength) >= MAX_OSC_TEXT_NUMBER_LENGTH) {
+                return false;
+            }
+            memcpy(&number[numberLength], decimalPoint, decimalPointLength);
+            numberLength += decimalPointLength;
+            continue;
+        }
+        if ((numberLength + 1) >= MAX_OSC_TEXT_NUMBER_LENGTH) {
+            return false;
+        }
+        number[numberLength++] = character;
+    }
+    number[numberLength] = '\0';
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// End of file
@@ -0,0 +1,51 @@
+/**
+ * @file OscText.h
+ * @author Seb Madgwick
+ * @brief Functions for converting between OSC packets and text.  Each OSC
+ * message is represented by a line of text containing the OSC address pattern,
+ * the OSC type tag string, and the arguments, for example:
+ * /example ,ifsb 1 2.5 "text" 0x0102
+ * @see http://opensoundcontrol.org/spec-1_0
+ */
+
+#ifndef OSC_TEXT_H
+#define OSC_TEXT_H
+
+//------------------------------------------------------------------------------
+// Includes
+
+#include "OscCommon.h"
+#include "OscError.h"
+#include "OscPacket.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+//------------------------------------------------------------------------------
+// Definitions
+
+/**
+ * @brief Maximum length of the text of a number or OSC time tag.
+ */
+#define MAX_OSC_TEXT_NUMBER_LENGTH (32)
+
+//------------------------------------------------------------------------------
+// Function prototypes
+
+OscError OscTextFormatPacket(const OscPacket * const oscPacket, size_t * const textSize, char * const destination, const size_t destinationSize);
+OscError OscTextFormatContents(const void * const oscContents, const size_t contentsSize, size_t * const textSize, char * const destination, const size_t destinationSize);
+OscError OscTextParseLines(const char * const text, const size_t textSize, size_t * const textParsed, size_t * const contentsSize, char * const destination, const size_t destinationSize);
+OscError OscTextParseMessage(const char * const text, const size_t textLength, size_t * const oscMessageSize, char * const destination, const size_t destinationSize);
+size_t OscTextFormatInt64(const int64_t int64, char * const text);
+size_t OscTextFormatFloat32(const float float32, char * const text);
+size_t OscTextFormatDouble(const double double64, char * const text);
+size_t OscTextFormatTimeTag(const OscTimeTag oscTimeTag, char * const text);
+bool OscTextParseInt64(const char * const text, const size_t textLength, const int64_t minimum, const int64_t maximum, int64_t * const int64);
+bool OscTextParseFloat32(const char * const text, const size_t textLength, float * const float32);
+bool OscTextParseDouble(const char * const text, const size_t textLength, double * const double64);
+bool OscTextParseTimeTag(const char * const text, const size_t textLength, OscTimeTag * const oscTimeTag);
+
+#endif
+
+//------------------------------------------------------------------------------
+// End of file